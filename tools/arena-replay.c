@@ -0,0 +1,200 @@
+/* $Id$ */
+
+/*
+ *  Copyright (c) 2012 Rafael Warnault
+ *  All rights reserved.
+ * 
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+	Replays chat messages through the permission checks every rule runs,
+	to compare the scratch memory of a dispatch before and after the
+	arena. "pool" splits the permission lists into autoreleased strings
+	and drains the pool every 100 messages, like the runloop used to;
+	"arena" tokenizes in the dispatch arena and drops both the arena and
+	a pool after each message, like wr_messages_handle_message does now.
+	
+	Build from the top of the tree once libwired is built, and run each
+	mode in its own process, the peak RSS is per process:
+	
+	  cc -I. -Iwirebot -Ilibwired/include -O2 -o arena-replay \
+	     tools/arena-replay.c wirebot/arena.c -lwired -lssl -lcrypto -lxml2 -lz
+	  ./arena-replay pool 1000000
+	  ./arena-replay arena 1000000
+*/
+
+#include "config.h"
+
+#include <sys/time.h>
+#include <sys/resource.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <wired/wired.h>
+
+#include "arena.h"
+
+#define WR_REPLAY_RULES					20
+
+static const char						*wr_replay_permissions[] = {
+	"admin,moderator,guest",
+	"any",
+	",operator,,guest",
+	"nark,rafael,admin,moderator,operator",
+};
+
+static const char						*wr_replay_messages[] = {
+	"!imdb The Matrix 1999",
+	"hello everyone",
+	"!seen somebody",
+	"did anyone upload the new release yet?",
+};
+
+
+static wi_boolean_t						wr_replay_pool(wi_string_t *, wi_string_t *, wi_string_t *);
+static wi_boolean_t						wr_replay_arena(wr_arena_t *, wi_string_t *, wi_string_t *, wi_string_t *);
+static wi_boolean_t						wr_replay_contains(const char *, const char *);
+
+
+
+int main(int argc, const char **argv) {
+	wi_pool_t			*pool, *message_pool;
+	wr_arena_t			*arena;
+	wi_string_t			*nick, *login, *text, *permissions[WR_REPLAY_RULES];
+	wi_boolean_t		use_arena;
+	wi_uinteger_t		i, j, count, matched;
+	struct timeval		start, end;
+	struct rusage		usage;
+	
+	wi_initialize();
+	wi_load(argc, argv);
+	
+	if(argc < 2 || (strcmp(argv[1], "pool") != 0 && strcmp(argv[1], "arena") != 0)) {
+		fprintf(stderr, "Usage: %s pool|arena [messages]\n", argv[0]);
+		
+		return 2;
+	}
+	
+	use_arena	= (strcmp(argv[1], "arena") == 0);
+	count		= argc > 2 ? strtoul(argv[2], NULL, 10) : 1000000;
+	pool		= wi_pool_init(wi_pool_alloc());
+	arena		= wr_arena_create(WR_ARENA_CHUNK_SIZE);
+	nick		= wi_retain(WI_STR("somebody"));
+	login		= wi_retain(WI_STR("guest"));
+	matched		= 0;
+	
+	for(i = 0; i < WR_REPLAY_RULES; i++)
+		permissions[i] = wi_string_init_with_cstring(wi_string_alloc(), wr_replay_permissions[i % 4]);
+	
+	gettimeofday(&start, NULL);
+	
+	for(i = 0; i < count; i++) {
+		message_pool = use_arena ? wi_pool_init(wi_pool_alloc()) : NULL;
+		
+		// what a chat message costs before any rule looks at it
+		text = wi_string_with_format(WI_STR("%s"), wr_replay_messages[i % 4]);
+		text = wi_string_by_deleting_surrounding_whitespace(text);
+		
+		for(j = 0; j < WR_REPLAY_RULES; j++) {
+			if(use_arena ? wr_replay_arena(arena, nick, login, permissions[j]) : wr_replay_pool(nick, login, permissions[j]))
+				matched++;
+		}
+		
+		if(use_arena) {
+			wr_arena_reset(arena);
+			wi_release(message_pool);
+		}
+		else if(i % 100 == 99) {
+			wi_pool_drain(pool);
+		}
+	}
+	
+	gettimeofday(&end, NULL);
+	getrusage(RUSAGE_SELF, &usage);
+	
+	printf("%s: %lu messages, %lu rules matched, %.3f seconds, %.0f ns per message, peak rss %ld kB\n",
+		argv[1], (unsigned long) count, (unsigned long) matched,
+		(end.tv_sec - start.tv_sec) + (end.tv_usec - start.tv_usec) / 1000000.0,
+		((end.tv_sec - start.tv_sec) * 1e9 + (end.tv_usec - start.tv_usec) * 1e3) / (count ? count : 1),
+		usage.ru_maxrss);
+	
+	wr_arena_destroy(arena);
+	wi_release(pool);
+	
+	return 0;
+}
+
+
+
+static wi_boolean_t wr_replay_pool(wi_string_t *nick, wi_string_t *login, wi_string_t *permissions) {
+	wi_enumerator_t		*enumerator;
+	wi_string_t			*permission;
+	
+	// the checks as they were, one autoreleased string per token
+	enumerator = wi_array_data_enumerator(wi_string_components_separated_by_string(permissions, WI_STR(",")));
+	
+	while((permission = wi_enumerator_next_data(enumerator))) {
+		if(wi_is_equal(permission, WI_STR("any")))
+			return true;
+		
+		if(wi_string_contains_string(nick, permission, WI_STRING_CASE_INSENSITIVE) || wi_is_equal(login, permission))
+			return true;
+	}
+	
+	return false;
+}
+
+
+
+static wi_boolean_t wr_replay_arena(wr_arena_t *arena, wi_string_t *nick, wi_string_t *login, wi_string_t *permissions) {
+	char		*buffer, *permission;
+	
+	// the checks as _wb_bot_check_permissions() does them now
+	buffer = wr_arena_strdup(arena, wi_string_cstring(permissions));
+	
+	while((permission = strsep(&buffer, ","))) {
+		if(strcmp(permission, "any") == 0)
+			return true;
+		
+		if(wr_replay_contains(wi_string_cstring(nick), permission) || strcmp(wi_string_cstring(login), permission) == 0)
+			return true;
+	}
+	
+	return false;
+}
+
+
+
+static wi_boolean_t wr_replay_contains(const char *string, const char *substring) {
+	size_t		length;
+	
+	length = strlen(substring);
+	
+	for(; *string; string++) {
+		if(strncasecmp(string, substring, length) == 0)
+			return true;
+	}
+	
+	return (length == 0);
+}
@@ -0,0 +1,132 @@
+/* $Id$ */
+
+/*
+ *  Copyright (c) 2012 Rafael Warnault
+ *  All rights reserved.
+ * 
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/*
+	Times user lookups by uid at 10, 1k and 50k users, the way chats did
+	them before and after the integer maps: a wi_dictionary_t keyed by a
+	wi_number_t made for every lookup, and a wr_intmap_t keyed by the uid
+	itself. The dictionary side drains its pool every 100 lookups, like
+	the runloop.
+	
+	Build from the top of the tree once libwired is built:
+	
+	  cc -I. -Iwirebot -Ilibwired/include -O2 -o intmap-bench \
+	     tools/intmap-bench.c wirebot/intmap.c -lwired -lssl -lcrypto -lxml2 -lz
+	  ./intmap-bench [lookups]
+*/
+
+#include "config.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include <wired/wired.h>
+
+#include "intmap.h"
+
+static double							wr_bench_time(void);
+
+
+
+int main(int argc, const char **argv) {
+	wi_pool_t					*pool;
+	wi_mutable_dictionary_t		*dictionary;
+	wr_intmap_t					*map;
+	wi_number_t					*user;
+	wi_uinteger_t				sizes[] = { 10, 1000, 50000 };
+	wi_uinteger_t				i, j, lookups, found;
+	double						time, dictionary_time, map_time;
+	
+	wi_initialize();
+	wi_load(argc, argv);
+	
+	lookups	= argc > 1 ? strtoul(argv[1], NULL, 10) : 10000000;
+	pool	= wi_pool_init(wi_pool_alloc());
+	
+	for(i = 0; i < sizeof(sizes) / sizeof(*sizes); i++) {
+		dictionary	= wi_dictionary_init(wi_mutable_dictionary_alloc());
+		map			= wr_intmap_create(0);
+		
+		// uids are handed out in order by the server, the users stand in
+		// as numbers
+		for(j = 1; j <= sizes[i]; j++) {
+			user = wi_number_init_with_integer(wi_number_alloc(), j);
+			
+			wi_mutable_dictionary_set_data_for_key(dictionary, user, wi_number_with_integer(j));
+			wr_intmap_set_data_for_key(map, user, (uint32_t) j);
+			
+			wi_release(user);
+		}
+		
+		wi_pool_drain(pool);
+		
+		found	= 0;
+		time	= wr_bench_time();
+		
+		for(j = 0; j < lookups; j++) {
+			if(wi_dictionary_data_for_key(dictionary, wi_number_with_integer((j % sizes[i]) + 1)))
+				found++;
+			
+			if(j % 100 == 99)
+				wi_pool_drain(pool);
+		}
+		
+		dictionary_time	= wr_bench_time() - time;
+		time			= wr_bench_time();
+		
+		for(j = 0; j < lookups; j++) {
+			if(wr_intmap_data_for_key(map, (uint32_t) (j % sizes[i]) + 1))
+				found++;
+		}
+		
+		map_time = wr_bench_time() - time;
+		
+		printf("%6lu users: dictionary %.1f ns, intmap %.1f ns per lookup, %lu found\n",
+			(unsigned long) sizes[i],
+			dictionary_time * 1e9 / lookups,
+			map_time * 1e9 / lookups,
+			(unsigned long) found);
+		
+		wi_release(dictionary);
+		wr_intmap_destroy(map);
+	}
+	
+	wi_release(pool);
+	
+	return 0;
+}
+
+
+
+static double wr_bench_time(void) {
+	struct timespec		ts;
+	
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	
+	return ts.tv_sec + ts.tv_nsec / 1e9;
+}
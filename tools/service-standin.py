@@ -0,0 +1,100 @@
+#!/usr/bin/env python3
+
+# $Id$
+
+"""
+Local stand-in for the OMDB service, serving canned responses.
+
+Service lookups are plain HTTP and libcurl honours http_proxy, so the bot
+can be pointed at this server without changing its URL:
+
+    tools/service-standin.py --port 8080 --connect-delay 0.05 &
+    http_proxy=http://127.0.0.1:8080 wirebot -D -d
+
+Each new connection is held back by --connect-delay seconds to stand in for
+the DNS, TCP and TLS setup of the real service, and each request by
+--delay seconds. With -d the bot logs in wire.out how long every lookup
+took, and this server logs each new connection and each request on
+stderr. Comparing both between builds shows how often connections are
+reused and what that saves.
+
+Titles named "unknown" get the answer of a title the service does not
+know.
+"""
+
+import argparse
+import http.server
+import socketserver
+import sys
+import time
+import urllib.parse
+from xml.sax.saxutils import quoteattr
+
+
+FOUND = """<?xml version="1.0" encoding="UTF-8"?>
+<root response="True"><movie title=%s year="1999" genre="Action, Sci-Fi" imdbID="tt0133093" poster="http://127.0.0.1/poster.jpg"/></root>
+"""
+
+NOT_FOUND = """<?xml version="1.0" encoding="UTF-8"?>
+<root response="False"><error>Movie not found!</error></root>
+"""
+
+
+class Handler(http.server.BaseHTTPRequestHandler):
+    protocol_version = "HTTP/1.1"
+    disable_nagle_algorithm = True
+
+    def setup(self):
+        super().setup()
+        self.requests = 0
+        time.sleep(self.server.connect_delay)
+        sys.stderr.write("connection from %s:%d\n" % self.client_address)
+
+    def do_GET(self):
+        # proxied requests carry the absolute URL
+        query = urllib.parse.parse_qs(urllib.parse.urlsplit(self.path).query)
+        title = query.get("t", [""])[0]
+
+        time.sleep(self.server.delay)
+
+        body = (NOT_FOUND if title.lower() == "unknown" else FOUND % quoteattr(title)).encode("utf-8")
+
+        self.send_response(200)
+        self.send_header("Content-Type", "text/xml; charset=utf-8")
+        self.send_header("Content-Length", str(len(body)))
+        self.end_headers()
+        self.wfile.write(body)
+
+        self.requests += 1
+
+    def log_message(self, format, *args):
+        sys.stderr.write("%s:%d request %d: %s\n" % (self.client_address + (self.requests + 1, format % args)))
+
+
+class Server(socketserver.ThreadingMixIn, http.server.HTTPServer):
+    daemon_threads = True
+    allow_reuse_address = True
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Serve canned OMDB responses.")
+    parser.add_argument("--host", default="127.0.0.1")
+    parser.add_argument("--port", type=int, default=8080)
+    parser.add_argument("--connect-delay", type=float, default=0.05,
+                        help="seconds added to every new connection")
+    parser.add_argument("--delay", type=float, default=0.0,
+                        help="seconds added to every request")
+    args = parser.parse_args()
+
+    server = Server((args.host, args.port), Handler)
+    server.connect_delay = args.connect_delay
+    server.delay = args.delay
+
+    try:
+        server.serve_forever()
+    except KeyboardInterrupt:
+        pass
+
+
+if __name__ == "__main__":
+    main()
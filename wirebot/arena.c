@@ -0,0 +1,173 @@
+/* $Id$ */
+
+/*
+ *  Copyright (c) 2012 Rafael Warnault
+ *  All rights reserved.
+ * 
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "config.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <wired/wired.h>
+
+#include "arena.h"
+
+/*
+	A bump allocator for scratch data that lives no longer than one message
+	dispatch. Chunks are kept across resets and reused, so resetting the
+	arena is O(1) and a steady state does no malloc at all.
+*/
+
+#define WR_ARENA_ALIGNMENT				(sizeof(void *) * 2)
+
+struct _wr_arena_chunk {
+	struct _wr_arena_chunk			*next;
+	size_t							size;
+	size_t							used;
+};
+typedef struct _wr_arena_chunk		wr_arena_chunk_t;
+
+// the data of a chunk starts after its header rounded up to the alignment,
+// the header alone would leave it 8-aligned on 64-bit
+#define WR_ARENA_HEADER_SIZE			\
+	((sizeof(wr_arena_chunk_t) + WR_ARENA_ALIGNMENT - 1) & ~(WR_ARENA_ALIGNMENT - 1))
+#define WR_ARENA_CHUNK_DATA(chunk)		\
+	((char *) (chunk) + WR_ARENA_HEADER_SIZE)
+
+struct _wr_arena {
+	wr_arena_chunk_t				*first;
+	wr_arena_chunk_t				*current;
+	size_t							chunk_size;
+	size_t							size;
+};
+
+
+static wr_arena_chunk_t *			wr_arena_chunk_create(size_t);
+
+
+
+wr_arena_t * wr_arena_create(size_t chunk_size) {
+	wr_arena_t		*arena;
+	
+	if(chunk_size == 0)
+		chunk_size = WR_ARENA_CHUNK_SIZE;
+	
+	arena				= wi_malloc(sizeof(wr_arena_t));
+	arena->chunk_size	= chunk_size;
+	arena->first		= wr_arena_chunk_create(chunk_size);
+	arena->current		= arena->first;
+	arena->size			= chunk_size;
+	
+	return arena;
+}
+
+
+
+void wr_arena_destroy(wr_arena_t *arena) {
+	wr_arena_chunk_t	*chunk, *next;
+	
+	if(!arena)
+		return;
+	
+	for(chunk = arena->first; chunk; chunk = next) {
+		next = chunk->next;
+		
+		wi_free(chunk);
+	}
+	
+	wi_free(arena);
+}
+
+
+
+#pragma mark -
+
+void * wr_arena_alloc(wr_arena_t *arena, size_t size) {
+	wr_arena_chunk_t	*chunk;
+	void				*pointer;
+	
+	size = (size + WR_ARENA_ALIGNMENT - 1) & ~(WR_ARENA_ALIGNMENT - 1);
+	
+	while(arena->current->used + size > arena->current->size) {
+		if(!arena->current->next) {
+			chunk = wr_arena_chunk_create(WI_MAX(arena->chunk_size, size));
+			
+			arena->current->next = chunk;
+			arena->size += chunk->size;
+		}
+		
+		arena->current = arena->current->next;
+		arena->current->used = 0;
+	}
+	
+	pointer = WR_ARENA_CHUNK_DATA(arena->current) + arena->current->used;
+	arena->current->used += size;
+	
+	return pointer;
+}
+
+
+
+char * wr_arena_strdup(wr_arena_t *arena, const char *string) {
+	char		*copy;
+	size_t		length;
+	
+	length	= strlen(string) + 1;
+	copy	= wr_arena_alloc(arena, length);
+	
+	memcpy(copy, string, length);
+	
+	return copy;
+}
+
+
+
+#pragma mark -
+
+void wr_arena_reset(wr_arena_t *arena) {
+	arena->current			= arena->first;
+	arena->current->used	= 0;
+}
+
+
+
+size_t wr_arena_size(wr_arena_t *arena) {
+	return arena->size;
+}
+
+
+
+#pragma mark -
+
+static wr_arena_chunk_t * wr_arena_chunk_create(size_t size) {
+	wr_arena_chunk_t	*chunk;
+	
+	chunk			= wi_malloc(WR_ARENA_HEADER_SIZE + size);
+	chunk->next		= NULL;
+	chunk->size		= size;
+	chunk->used		= 0;
+	
+	return chunk;
+}
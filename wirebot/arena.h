@@ -0,0 +1,48 @@
+/* $Id$ */
+
+/*
+ *  Copyright (c) 2012 Rafael Warnault
+ *  All rights reserved.
+ * 
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef WR_ARENA_H
+#define WR_ARENA_H 1
+
+#include <sys/types.h>
+
+#define WR_ARENA_CHUNK_SIZE				16384
+
+typedef struct _wr_arena				wr_arena_t;
+
+
+wr_arena_t *							wr_arena_create(size_t);
+void									wr_arena_destroy(wr_arena_t *);
+
+void *									wr_arena_alloc(wr_arena_t *, size_t);
+char *									wr_arena_strdup(wr_arena_t *, const char *);
+
+void									wr_arena_reset(wr_arena_t *);
+size_t									wr_arena_size(wr_arena_t *);
+
+#endif /* WR_ARENA_H */
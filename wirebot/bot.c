@@ -31,10 +31,15 @@
 #include "chats.h"
 #include "client.h"
 #include "commands.h"
+#include "intmap.h"
+#include "pathtrie.h"
+#include "listings.h"
+#include "seen.h"
 #include "messages.h"
 #include "settings.h"
 #include <wired/wired.h>
 #include <string.h>
+#include <strings.h>
 
 
 
@@ -44,12 +49,17 @@ struct _wb_bot {
 	wi_runtime_base_t				base;
 
 	wi_boolean_t					started;
-	wi_boolean_t					subscribing;
 	wi_string_t 					*path;
 	wi_string_t						*xml;
 	wi_mutable_array_t				*commands;
 	wi_mutable_array_t				*rules;
+	wi_mutable_array_t				*public_rules;
+	wi_mutable_array_t				*private_rules;
+	wr_intmap_t						*chat_rules;
 	wi_mutable_array_t				*watchers;
+	wr_pathtrie_t					*watcher_index;
+	wi_string_t						*watcher_lookup_path;
+	wi_array_t						*watcher_lookup;
 };  
 
 static void							wb_bot_dealloc(wi_runtime_instance_t *);
@@ -74,20 +84,25 @@ static wi_runtime_class_t			wb_bot_runtime_class = {
 
 
 
+static wi_boolean_t 				_wb_bot_dispatch_message(wb_bot_t *, wi_p7_message_t *);
 static wi_array_t * 				_wb_bot_decompose_bot_command_arguments(wi_p7_message_t *);
 static wi_string_t * 				_wb_bot_recompose_bot_command_arguments(wi_array_t *);
 static void 						_wb_bot_split_command(wi_string_t *, wi_string_t **, wi_string_t **);
+static wi_boolean_t 				_wb_bot_check_permissions(wr_user_t *, wi_string_t *);
+static wi_boolean_t 				_wb_bot_cstring_contains_case_insensitive(const char *, const char *);
 
 static wi_boolean_t 				_wb_bot_load_file(wb_bot_t *, wi_string_t *);
 static wi_boolean_t 				_wb_bot_load_wirebot(wb_bot_t *, xmlDocPtr);
 static wi_boolean_t 				_wb_bot_load_rules(wb_bot_t *, xmlNodePtr);
+static void 						_wb_bot_index_rules(wb_bot_t *);
+static wi_array_t * 				_wb_bot_outputs_for_message_in_rules(wi_array_t *, wr_user_t *, wi_p7_message_t *);
 static wi_boolean_t 				_wb_bot_load_commands(wb_bot_t *, xmlNodePtr);
 static wi_boolean_t 				_wb_bot_load_watchers(wb_bot_t *, xmlNodePtr);
 
 static wb_input_t*					_wb_bot_load_input_with_node(wb_input_t *, xmlNodePtr);
 static wb_output_t*					_wb_bot_load_output_with_node(wb_output_t *, xmlNodePtr);
 
-void 								_wb_bot_subscribe_to_remote_directory_for_watcher(wb_bot_t *, wb_watcher_t *);
+void 								_wb_bot_add_subscribe_messages_for_watcher(wb_bot_t *, wb_watcher_t *, wi_mutable_array_t *);
 void								_wb_bot_unsubscribe_to_remote_directory_for_watcher(wb_bot_t *, wb_watcher_t *);
 
 
@@ -152,11 +167,14 @@ wb_bot_t * wb_bot_alloc(void) {
 wb_bot_t * wb_bot_init_with_file(wb_bot_t *bot, wi_string_t *path) {
 
 	bot->started 				= true;
-	bot->subscribing			= false;
 	bot->path					= wi_retain(path);
 	bot->commands				= wi_array_init(wi_mutable_array_alloc());
 	bot->rules					= wi_array_init(wi_mutable_array_alloc());
+	bot->public_rules			= wi_array_init(wi_mutable_array_alloc());
+	bot->private_rules			= wi_array_init(wi_mutable_array_alloc());
+	bot->chat_rules				= wr_intmap_create(0);
 	bot->watchers 				= wi_array_init(wi_mutable_array_alloc());
+	bot->watcher_index			= wr_pathtrie_create();
 
 	if(!_wb_bot_load_file(bot, path)) {
 		wi_log_error(WI_STR("Wirebot cannot be initialized properly, shutdown."), path);
@@ -172,6 +190,37 @@ wb_bot_t * wb_bot_init_with_file(wb_bot_t *bot, wi_string_t *path) {
 #pragma mark bot engine methods
 
 wi_boolean_t wb_bot_dispatch_message(wb_bot_t *bot, wi_p7_message_t *message) {
+	wr_chat_t				*chat;
+	wi_p7_uint32_t			cid;
+	wi_boolean_t			result;
+
+	// replies go back to the chat the message came from
+	if(!wi_p7_message_get_uint32_for_name(message, &cid, WI_STR("wired.chat.id")))
+		cid = WR_PUBLIC_CID;
+
+	// senders are looked up in the public chat, rules wait for both user
+	// lists and run when wr_message_chat_user_list_done replays them
+	chat = wr_chats_chat_with_cid(cid);
+
+	if(!chat || wr_chat_is_loaded(chat))
+		chat = wr_connection->public_chat;
+
+	if(!wr_chat_is_loaded(chat)) {
+		wr_chat_defer_message(chat, message);
+
+		return false;
+	}
+
+	wr_commands_chat_id = cid;
+	result = _wb_bot_dispatch_message(bot, message);
+	wr_commands_chat_id = WR_PUBLIC_CID;
+
+	return result;
+}
+
+
+
+static wi_boolean_t _wb_bot_dispatch_message(wb_bot_t *bot, wi_p7_message_t *message) {
 	wi_array_t 				*outputs;
 	wr_user_t       		*user;
 	wb_command_t 			*command;
@@ -182,11 +231,15 @@ wi_boolean_t wb_bot_dispatch_message(wb_bot_t *bot, wi_p7_message_t *message) {
 	wi_p7_message_get_uint32_for_name(message, &uid, WI_STR("wired.user.id"));
 
 	// get the user
-	user 	= wr_chat_user_with_uid(wr_public_chat, uid);
+	user 	= wr_chat_user_with_uid(wr_connection->public_chat, uid);
 	buffer	= wb_bot_input_for_message(message);
 
+	// a deferred message may be replayed after its sender left
+	if(!user)
+		return false;
+
 	// do not reply to myself
-	if(wr_user_id(user) == wb_user_id)
+	if(wr_user_id(user) == wr_connection->user_id)
 		return false;
 
 	// split command and arguments
@@ -255,17 +308,39 @@ void wb_bot_apply_settings(wi_set_t *changes) {
 
 void wb_bot_subscribe_watchers(wb_bot_t *bot) {
 	wi_enumerator_t			*enumerator;
+	wi_p7_message_t 		*message;
+	wr_connection_t			*connection;
+
+	// watchers are served by the first configured server
+	connection = wr_connections_first();
+
+	if(!connection || !connection->connected)
+		return;
+
+	enumerator = wi_array_data_enumerator(wb_bot_subscribe_watchers_messages(bot));
+
+	while((message = wi_enumerator_next_data(enumerator))) {
+		wr_client_send_message_on_connection(connection, message);
+	}
+}
+
+wi_array_t * wb_bot_subscribe_watchers_messages(wb_bot_t *bot) {
+	wi_enumerator_t			*enumerator;
+	wi_mutable_array_t 		*messages;
 	wb_watcher_t 			*watcher;
-	wi_string_t 			*path;
+
+	messages = wi_mutable_array();
 
 	if(!bot->watchers)
-		return;
+		return messages;
 
 	enumerator = wi_array_data_enumerator(bot->watchers);
 
 	while((watcher = wi_enumerator_next_data(enumerator))) {
-		_wb_bot_subscribe_to_remote_directory_for_watcher(bot, watcher);
+		_wb_bot_add_subscribe_messages_for_watcher(bot, watcher, messages);
 	}
+
+	return messages;
 }
 
 void wb_bot_unsubscribe_watchers(wb_bot_t *bot) {
@@ -283,37 +358,86 @@ void wb_bot_unsubscribe_watchers(wb_bot_t *bot) {
 	}
 }
 
-wb_watcher_t * wb_bot_watcher_for_path(wb_bot_t *bot, wi_string_t *path) {
+wi_array_t * wb_bot_watchers_for_path(wb_bot_t *bot, wi_string_t *path) {
+	wi_array_t				*watchers;
+
+	// a listing hits the same directory for every entry, remember the last one
+	if(bot->watcher_lookup_path && wi_is_equal(bot->watcher_lookup_path, path))
+		return bot->watcher_lookup;
+
+	watchers = wr_pathtrie_data_for_path(bot->watcher_index, path);
+
+	wi_release(bot->watcher_lookup_path);
+	wi_release(bot->watcher_lookup);
+
+	bot->watcher_lookup_path	= wi_copy(path);
+	bot->watcher_lookup			= wi_retain(watchers);
+
+	return watchers;
+}
+
+void wb_bot_log_statistics(wb_bot_t *bot) {
 	wi_enumerator_t			*enumerator;
 	wb_watcher_t 			*watcher;
 
+	wb_listings_log_statistics();
+
 	if(!bot->watchers)
-		return NULL;
+		return;
 
 	enumerator = wi_array_data_enumerator(bot->watchers);
 
-	while((watcher = wi_enumerator_next_data(enumerator))) {
-		if(wi_is_equal(wb_watcher_path(watcher), path)) {
-			return watcher;
-		}
-	}
-	return NULL;
+	while((watcher = wi_enumerator_next_data(enumerator)))
+		wb_watcher_log_statistics(watcher);
 }
 
 
 
 
 wi_array_t * wb_bot_outputs_for_message(wb_bot_t *bot, wr_user_t *user, wi_p7_message_t *message) {
+	wi_array_t 				*rules, *outputs;
+	wi_p7_uint32_t			cid;
+
+	// private messages and broadcasts are outside of any chat: only rules
+	// left unscoped or scoped to private chats apply, both are indexed in
+	// private_rules
+	if(!wi_p7_message_get_uint32_for_name(message, &cid, WI_STR("wired.chat.id")))
+		return _wb_bot_outputs_for_message_in_rules(bot->private_rules, user, message);
+
+	// rules naming this very chat come first
+	rules = wr_intmap_data_for_key(bot->chat_rules, cid);
+
+	if(rules) {
+		outputs = _wb_bot_outputs_for_message_in_rules(rules, user, message);
+
+		if(outputs)
+			return outputs;
+	}
+
+	if(cid == WR_PUBLIC_CID)
+		return _wb_bot_outputs_for_message_in_rules(bot->public_rules, user, message);
+
+	return _wb_bot_outputs_for_message_in_rules(bot->private_rules, user, message);
+}
+
+
+
+static wi_array_t * _wb_bot_outputs_for_message_in_rules(wi_array_t *rules, wr_user_t *user, wi_p7_message_t *message) {
 	
 	wi_enumerator_t			*rules_enumerator, *inputs_enumerator, *outputs_enumerator;
 	wi_mutable_array_t 		*results;
-	wi_string_t 			*message_name, *message_input;
+	wi_string_t 			*message_input;
+	wr_message_id_t			message_id;
 	wb_rule_t 				*rule;
 	wb_input_t 				*input;
 	wb_output_t 			*output;
 
-	rules_enumerator 	= wi_array_data_enumerator(bot->rules);
+	rules_enumerator 	= wi_array_data_enumerator(rules);
 	results				= wi_mutable_array();
+	message_id			= wr_messages_id_for_message(message);
+
+	if(message_id == WR_MESSAGE_UNKNOWN)
+		return NULL;
 
 	while((rule = wi_enumerator_next_data(rules_enumerator))) {
 
@@ -323,9 +447,7 @@ wi_array_t * wb_bot_outputs_for_message(wb_bot_t *bot, wr_user_t *user, wi_p7_me
 			input = NULL;
 
 			while((input = wi_enumerator_next_data(inputs_enumerator))) {
-				message_name = wi_p7_message_name(message);
-
-				if(wi_is_equal(message_name, wb_input_message_name(input))) {
+				if(wb_input_message_id(input) == message_id) {
 
 					message_input = wb_bot_input_for_message(message);
 
@@ -385,51 +507,11 @@ wb_command_t * wb_bot_command_for_message(wb_bot_t *bot, wr_user_t *user, wi_p7_
 #pragma mark -
 
 wi_boolean_t wb_bot_check_rule_permissions(wr_user_t *user, wb_rule_t *rule) {
-	wi_enumerator_t			*enumerator;
-	wi_string_t 			*permissions, *permission, *nick, *login;
-	wi_array_t 				*components;
-
-	permissions 	= wb_rule_permissions(rule);
-	components 		= wi_string_components_separated_by_string(permissions, WI_STR(","));
-
-	if(!components)
-		return true;
-
-	enumerator 		= wi_array_data_enumerator(components);
-
-	while((permission = wi_enumerator_next_data(enumerator))) {
-		if(wi_is_equal(permission, WI_STR("any")))
-			return true;
-
-		if (wi_string_contains_string(wr_user_nick(user), permission, WI_STRING_CASE_INSENSITIVE) ||
-			wi_is_equal(wr_user_login(user), permission))
-			return true;
-	}	
-	return false;
+	return _wb_bot_check_permissions(user, wb_rule_permissions(rule));
 }
 
 wi_boolean_t wb_bot_check_command_permissions(wr_user_t *user, wb_command_t *command) {
-	wi_enumerator_t			*enumerator;
-	wi_string_t 			*permissions, *permission, *nick, *login;
-	wi_array_t 				*components;
-
-	permissions 	= wb_command_permissions(command);
-	components 		= wi_string_components_separated_by_string(permissions, WI_STR(","));
-
-	if(!components)
-		return true;
-
-	enumerator 		= wi_array_data_enumerator(components);
-
-	while((permission = wi_enumerator_next_data(enumerator))) {
-		if(wi_is_equal(permission, WI_STR("any")))
-			return true;
-
-		if (wi_string_contains_string(wr_user_nick(user), permission, WI_STRING_CASE_INSENSITIVE) ||
-			wi_is_equal(wr_user_login(user), permission))
-			return true;
-	}	
-	return false;
+	return _wb_bot_check_permissions(user, wb_command_permissions(command));
 }
 
 
@@ -478,31 +560,23 @@ wi_boolean_t wb_bot_check_input_match(wb_input_t *input, wi_string_t *message_in
 }
 
 wi_string_t * wb_bot_input_for_message(wi_p7_message_t *message) {
-	wi_string_t 	* result;
+	switch(wr_messages_id_for_message(message)) {
+		case WR_MESSAGE_CHAT_SAY:
+			return wi_p7_message_string_for_name(message, WI_STR("wired.chat.say"));
 
-	if(wi_is_equal(wi_p7_message_name(message), WI_STR("wired.chat.say"))) {
-		result = wi_p7_message_string_for_name(message, WI_STR("wired.chat.say"));
+		case WR_MESSAGE_CHAT_ME:
+			return wi_p7_message_string_for_name(message, WI_STR("wired.chat.me"));
 
-	} else if(wi_is_equal(wi_p7_message_name(message), WI_STR("wired.chat.me"))) {
-		result = wi_p7_message_string_for_name(message, WI_STR("wired.chat.me"));
+		case WR_MESSAGE_MESSAGE_MESSAGE:
+			return wi_p7_message_string_for_name(message, WI_STR("wired.message.message"));
 
-	} else if(wi_is_equal(wi_p7_message_name(message), WI_STR("wired.message.message"))) {
-		result = wi_p7_message_string_for_name(message, WI_STR("wired.message.message"));
+		case WR_MESSAGE_CHAT_USER_JOIN:
+		case WR_MESSAGE_CHAT_USER_LEAVE:
+			return WI_STR("");
 
-	} else if(wi_is_equal(wi_p7_message_name(message), WI_STR("wired.message.message"))) {
-		result = wi_p7_message_string_for_name(message, WI_STR("wired.message.message"));
-
-	} else if(wi_is_equal(wi_p7_message_name(message), WI_STR("wired.chat.user_join"))) {
-		result = WI_STR("");
-
-	} else if(wi_is_equal(wi_p7_message_name(message), WI_STR("wired.chat.user_leave"))) {
-		result = WI_STR("");
-
-	} else {
-		result = NULL;
+		default:
+			return NULL;
 	}
-
-	return result;
 }
 
 #pragma mark -
@@ -553,6 +627,13 @@ wi_boolean_t wb_bot_execute_output(wb_output_t *output, wr_user_t *user) {
 		if(delay > 0)
 			sleep(delay);
 
+		// the recipient is already known, do not resolve its nick again
+		if(wb_output_message_id(output) == WR_MESSAGE_MESSAGE_MESSAGE && user) {
+			wr_commands_send_private_message(wr_user_id(user), wb_output_text(output, user));
+
+			continue;
+		}
+
 		output_string 	= wb_output_wire_command_string(output, user);
 
 		wr_commands_parse_command(output_string, wb_output_is_chat(output));
@@ -632,6 +713,11 @@ wi_boolean_t wb_bot_execute_command(wb_bot_t *bot, wb_command_t *command, wi_str
 
 		return true;
 
+	} else if(wi_is_equal(command_name, WI_STR("seen"))) {
+		wb_bot_seen_command(bot, arguments, message, user);
+
+		return true;
+
 	} else {
 		if(output) 
 			wb_bot_execute_output(output, user);
@@ -679,9 +765,21 @@ wi_boolean_t wb_bot_reload_configuration(wb_bot_t *bot) {
 	wi_release(bot->xml);
 	wi_release(bot->commands);
 	wi_release(bot->rules);
-    wi_release(bot->watchers);
-    
+	wi_mutable_array_remove_all_data(bot->public_rules);
+	wi_mutable_array_remove_all_data(bot->private_rules);
+	wr_intmap_remove_all_data(bot->chat_rules);
 	wb_bot_unsubscribe_watchers(bot);
+	wb_listings_reset();
+	wb_watchers_reset();
+
+    wi_release(bot->watchers);
+    wi_release(bot->watcher_lookup_path);
+    wi_release(bot->watcher_lookup);
+
+    bot->watcher_lookup_path	= NULL;
+    bot->watcher_lookup			= NULL;
+
+    wr_pathtrie_remove_all_data(bot->watcher_index);
 
 	// init again
 	bot->path					= wi_retain(old_path);
@@ -724,7 +822,7 @@ void wb_bot_sleep_command(wb_bot_t *bot) {
 	wi_p7_message_t * 		message;
 	wr_user_t *				user;
 
-	user = wr_chat_user_with_uid(wr_public_chat, wb_user_id);
+	user = wr_chat_user_with_uid(wr_connection->public_chat, wr_connection->user_id);
 
 	if(user) {
 		message = wi_p7_message_with_name(WI_STR("wired.user.set_idle"), wr_p7_spec);
@@ -774,6 +872,7 @@ void wb_bot_help_command(wb_bot_t *bot, wi_p7_message_t *message, wr_user_t *use
 		"!reload          : Reload the dictionary\n"
 		"!nick [nickname] : Change the nick of the bot\n"
 		"!status [status] : Change the status of the bot\n"
+		"!seen [nickname] : Tell when a user was last seen\n"
 		"!help            : Show this help message\n\n"
 		);
 
@@ -787,6 +886,25 @@ void wb_bot_help_command(wb_bot_t *bot, wi_p7_message_t *message, wr_user_t *use
 
 
 
+void wb_bot_seen_command(wb_bot_t *bot, wi_string_t *arguments, wi_p7_message_t *message, wr_user_t *user) {
+	wi_string_t * 		nick;
+	wb_output_t * 		output;
+
+	nick 	= arguments ? wi_string_by_deleting_surrounding_whitespace(arguments) : NULL;
+	output 	= wb_output_init_with_message_name(wb_output_alloc(), wi_p7_message_name(message));
+
+	if(!nick || wi_string_length(nick) == 0)
+		wb_output_set_output(output, WI_STR("Usage: !seen <nickname>"));
+	else
+		wb_output_set_output(output, wb_seen_description(wr_connection->hostname, nick));
+
+	wb_bot_execute_output(output, user);
+
+	wi_release(output);
+}
+
+
+
 void wb_bot_command_reply_error(wi_string_t *command, wi_string_t *error) {
 
 }
@@ -800,14 +918,17 @@ static wi_array_t * _wb_bot_decompose_bot_command_arguments(wi_p7_message_t *mes
 	wi_array_t 				* arguments;
 	wi_string_t 			* message_input;
 
-	if(wi_is_equal(wi_p7_message_name(message), WI_STR("wired.chat.say"))) {
-		message_input 	= wi_p7_message_string_for_name(message, WI_STR("wired.chat.say"));
+	switch(wr_messages_id_for_message(message)) {
+		case WR_MESSAGE_CHAT_SAY:
+			message_input = wi_p7_message_string_for_name(message, WI_STR("wired.chat.say"));
+			break;
 
-	} else if(wi_is_equal(wi_p7_message_name(message), WI_STR("wired.message.message"))) {
-		message_input = wi_p7_message_string_for_name(message, WI_STR("wired.message.message"));
+		case WR_MESSAGE_MESSAGE_MESSAGE:
+			message_input = wi_p7_message_string_for_name(message, WI_STR("wired.message.message"));
+			break;
 
-	} else {
-		return NULL;
+		default:
+			return NULL;
 	}
 
 	return wi_string_components_separated_by_string(message_input, WI_STR(" "));
@@ -853,6 +974,45 @@ static void _wb_bot_split_command(wi_string_t *buffer, wi_string_t **out_command
 
 
 
+static wi_boolean_t _wb_bot_check_permissions(wr_user_t *user, wi_string_t *permissions) {
+	const char				*nick, *login;
+	char					*buffer, *permission;
+
+	if(!permissions)
+		return true;
+
+	nick 	= wr_user_nick(user) ? wi_string_cstring(wr_user_nick(user)) : NULL;
+	login 	= wr_user_login(user) ? wi_string_cstring(wr_user_login(user)) : NULL;
+
+	// tokenize in the dispatch arena, this runs for every rule on every message;
+	// strsep() keeps empty tokens like wi_string_components_separated_by_string()
+	buffer 	= wr_arena_strdup(wr_messages_arena, wi_string_cstring(permissions));
+
+	while((permission = strsep(&buffer, ","))) {
+		if(strcmp(permission, "any") == 0)
+			return true;
+
+		if((nick && _wb_bot_cstring_contains_case_insensitive(nick, permission)) ||
+		   (login && strcmp(login, permission) == 0))
+			return true;
+	}
+	return false;
+}
+
+
+static wi_boolean_t _wb_bot_cstring_contains_case_insensitive(const char *string, const char *substring) {
+	size_t		length;
+
+	length = strlen(substring);
+
+	for(; *string; string++) {
+		if(strncasecmp(string, substring, length) == 0)
+			return true;
+	}
+	return (length == 0);
+}
+
+
 static wi_boolean_t _wb_bot_load_file(wb_bot_t *bot, wi_string_t *path) {
 	xmlDocPtr	doc;
 	xmlChar		*buffer;
@@ -922,6 +1082,9 @@ static wi_boolean_t _wb_bot_load_rules(wb_bot_t *bot, xmlNodePtr node) {
 	wi_string_t 			*string;
 	wb_rule_t 				*rule;
 	xmlNodePtr				sub_node, next_node;
+	wi_boolean_t			result;
+	
+	result = true;
 	
 	for(sub_node = node->children; sub_node != NULL; sub_node = next_node) {
 		next_node = sub_node->next;
@@ -929,18 +1092,63 @@ static wi_boolean_t _wb_bot_load_rules(wb_bot_t *bot, xmlNodePtr node) {
 		if(sub_node->type == XML_ELEMENT_NODE) {
 
 			if(strcmp((const char *) sub_node->name, "rule") != 0) {
-				return false;
+				result = false;
+				break;
 			}
 
 			rule = wb_rule_init(wb_rule_alloc(), sub_node);
 
-			if(!rule)
-				return false;
+			if(!rule) {
+				result = false;
+				break;
+			}
 
 			wi_mutable_array_add_data(bot->rules, rule);
 		}
 	}
-	return true;
+
+	// index what was loaded even when a rule failed, the partitions must
+	// not keep serving the rules of the last dictionary
+	_wb_bot_index_rules(bot);
+
+	return result;
+}
+
+
+
+static void _wb_bot_index_rules(wb_bot_t *bot) {
+	wi_enumerator_t			*rules_enumerator, *ids_enumerator;
+	wi_mutable_array_t		*rules;
+	wi_number_t				*cid;
+	wb_rule_t 				*rule;
+
+	wi_mutable_array_remove_all_data(bot->public_rules);
+	wi_mutable_array_remove_all_data(bot->private_rules);
+	wr_intmap_remove_all_data(bot->chat_rules);
+
+	// split rules by chat once, so a message only walks the rules of its chat
+	rules_enumerator = wi_array_data_enumerator(bot->rules);
+
+	while((rule = wi_enumerator_next_data(rules_enumerator))) {
+		if(wb_rule_chats(rule) & WB_RULE_CHATS_PUBLIC)
+			wi_mutable_array_add_data(bot->public_rules, rule);
+
+		if(wb_rule_chats(rule) & WB_RULE_CHATS_PRIVATE)
+			wi_mutable_array_add_data(bot->private_rules, rule);
+
+		ids_enumerator = wi_array_data_enumerator(wb_rule_chat_ids(rule));
+
+		while((cid = wi_enumerator_next_data(ids_enumerator))) {
+			rules = wr_intmap_data_for_key(bot->chat_rules, wi_number_int32(cid));
+
+			if(!rules) {
+				rules = wi_mutable_array();
+				wr_intmap_set_data_for_key(bot->chat_rules, rules, wi_number_int32(cid));
+			}
+
+			wi_mutable_array_add_data(rules, rule);
+		}
+	}
 }
 
 static wi_boolean_t _wb_bot_load_commands(wb_bot_t *bot, xmlNodePtr node) {
@@ -985,6 +1193,14 @@ static wi_boolean_t _wb_bot_load_watchers(wb_bot_t *bot, xmlNodePtr node) {
 				return false;
 
 			wi_mutable_array_add_data(bot->watchers, watcher);
+
+			// only activated watchers receive listings
+			if(wb_watcher_activated(watcher)) {
+				wr_pathtrie_add_data_for_path(bot->watcher_index, watcher,
+					wb_watcher_path(watcher), wb_watcher_is_recursive(watcher));
+			}
+
+			wi_release(watcher);
 		}
 	}
 	
@@ -998,42 +1214,55 @@ static wi_boolean_t _wb_bot_load_watchers(wb_bot_t *bot, xmlNodePtr node) {
 
 #pragma mark -
 
-void _wb_bot_subscribe_to_remote_directory_for_watcher(wb_bot_t *bot, wb_watcher_t *watcher) {
+void _wb_bot_add_subscribe_messages_for_watcher(wb_bot_t *bot, wb_watcher_t *watcher, wi_mutable_array_t *messages) {
 	wi_p7_message_t     *message;
 	wi_string_t 		*path;
 
-	bot->subscribing = true;
-
 	path = wb_watcher_path(watcher);
 
 	wi_log_info(WI_STR("Watcher subscribe to directory: %@"), path);
 
-	message = wi_p7_message_with_name(WI_STR("wired.file.list_directory"), wr_p7_spec);
-	wi_p7_message_set_string_for_name(message, path, WI_STR("wired.file.path"));
-
-	if(wr_connected)
-    	wr_client_send_message(message);
+	// the initial listing is sent by the listings scheduler, which lists
+	// every watcher in parallel up to the configured limit
+	if(wb_watcher_activated(watcher)) {
+		wb_watcher_reset(watcher);
+		wb_listings_queue(path, WB_LISTING_INITIAL, false);
+	}
 
     message = wi_p7_message_with_name(WI_STR("wired.file.subscribe_directory"), wr_p7_spec);
     wi_p7_message_set_string_for_name(message, path, WI_STR("wired.file.path"));
-
-	if(wr_connected)
-    	wr_client_send_message(message);
+	wi_mutable_array_add_data(messages, message);
 }
 
 void _wb_bot_unsubscribe_to_remote_directory_for_watcher(wb_bot_t *bot, wb_watcher_t *watcher) {
+	wi_enumerator_t		*enumerator;
 	wi_p7_message_t     *message;
 	wi_string_t 		*path;
+	wr_connection_t		*connection;
 
 	path = wb_watcher_path(watcher);
 
 	wi_log_info(WI_STR("Watcher unsubscribe to directory: %@"), path);
 
+    connection = wr_connections_first();
+
+    if(!connection || !connection->connected)
+    	return;
+
     message = wi_p7_message_with_name(WI_STR("wired.file.unsubscribe_directory"), wr_p7_spec);
     wi_p7_message_set_string_for_name(message, path, WI_STR("wired.file.path"));
 
-    if(wr_connected)
-    	wr_client_send_message(message);
+    wr_client_send_message_on_connection(connection, message);
+
+    // a recursive watcher also subscribed to every directory of its tree
+    enumerator = wi_set_data_enumerator(wb_watcher_directories(watcher));
+
+    while((path = wi_enumerator_next_data(enumerator))) {
+	    message = wi_p7_message_with_name(WI_STR("wired.file.unsubscribe_directory"), wr_p7_spec);
+	    wi_p7_message_set_string_for_name(message, path, WI_STR("wired.file.path"));
+
+	    wr_client_send_message_on_connection(connection, message);
+    }
 }
 
 
@@ -1054,13 +1283,6 @@ wi_array_t * wb_bot_rules(wb_bot_t * bot) {
 	return bot->rules;
 }
 
-wi_boolean_t wb_bot_is_subscribing(wb_bot_t * bot) {
-	return bot->subscribing;
-}
-
-wi_boolean_t wb_bot_set_subscribing(wb_bot_t *bot, wi_boolean_t sub) {
-	bot->subscribing = sub;
-}
 
 
 
@@ -1073,7 +1295,13 @@ static void wb_bot_dealloc(wi_runtime_instance_t *instance) {
 	wi_release(bot->path);
 	wi_release(bot->commands);
 	wi_release(bot->rules);
+	wi_release(bot->public_rules);
+	wi_release(bot->private_rules);
+	wr_intmap_destroy(bot->chat_rules);
 	wi_release(bot->watchers);
+	wr_pathtrie_destroy(bot->watcher_index);
+	wi_release(bot->watcher_lookup_path);
+	wi_release(bot->watcher_lookup);
 	wi_release(bot->xml);
 }
 
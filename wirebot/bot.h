@@ -71,9 +71,6 @@ wi_string_t *						wb_bot_path(wb_bot_t *);
 wi_array_t *						wb_bot_commands(wb_bot_t *);
 wi_array_t *						wb_bot_rules(wb_bot_t *);
 
-wi_boolean_t						wb_bot_is_subscribing(wb_bot_t *);
-wi_boolean_t						wb_bot_set_subscribing(wb_bot_t *, wi_boolean_t);
-
 /* Bot Engine */
 wi_boolean_t						wb_bot_dispatch_message(wb_bot_t *, wi_p7_message_t *);
 void								wb_bot_apply_settings(wi_set_t *);
@@ -85,8 +82,10 @@ void								wb_bot_apply_settings(wi_set_t *);
 wi_boolean_t						wb_bot_reload_configuration(wb_bot_t *);
 
 void								wb_bot_subscribe_watchers(wb_bot_t *);
+wi_array_t *						wb_bot_subscribe_watchers_messages(wb_bot_t *);
 void								wb_bot_unsubscribe_watchers(wb_bot_t *);
-wb_watcher_t *						wb_bot_watcher_for_path(wb_bot_t *, wi_string_t *);
+wi_array_t *						wb_bot_watchers_for_path(wb_bot_t *, wi_string_t *);
+void								wb_bot_log_statistics(wb_bot_t *);
 
 wi_boolean_t						wb_bot_execute_output(wb_output_t *, wr_user_t *);
 wi_boolean_t						wb_bot_execute_command(wb_bot_t *, wb_command_t *, wi_string_t *, wr_user_t *, wi_p7_message_t *);
@@ -111,6 +110,7 @@ void								wb_bot_sleep_command(wb_bot_t *);
 void								wb_bot_nick_command(wb_bot_t *, wi_string_t *);
 void								wb_bot_status_command(wb_bot_t *, wi_string_t *);
 void								wb_bot_help_command(wb_bot_t *, wi_p7_message_t *, wr_user_t *);
+void								wb_bot_seen_command(wb_bot_t *, wi_string_t *, wi_p7_message_t *, wr_user_t *);
 
 #endif /* WR_BOT_H */
 
@@ -35,8 +35,8 @@
 #include <wired/wired.h>
 
 #include "chats.h"
-
-#define WR_PUBLIC_CID				1
+#include "connection.h"
+#include "intmap.h"
 
 
 struct _wr_chat {
@@ -44,7 +44,12 @@ struct _wr_chat {
 	
 	wr_cid_t						cid;
 	wi_mutable_array_t				*users_array;
-	wi_mutable_dictionary_t			*users_dictionary;
+	wr_intmap_t						*users_by_uid;
+	wi_mutable_dictionary_t			*users_by_nick;
+	
+	wi_boolean_t					loaded;
+	wi_mutable_array_t				*listed_users;
+	wi_mutable_array_t				*deferred_messages;
 };  
 
 
@@ -53,12 +58,13 @@ static wi_boolean_t					wr_chat_is_equal(wi_runtime_instance_t *, wi_runtime_ins
 static wi_string_t *				wr_chat_description(wi_runtime_instance_t *);
 static wi_hash_code_t				wr_chat_hash(wi_runtime_instance_t *);
 
+static void							wr_chat_index_user_nick(wr_chat_t *, wr_user_t *, wi_string_t *);
+static void							wr_chat_unindex_user_nick(wr_chat_t *, wr_user_t *, wi_string_t *);
 
-wr_chat_t							*wr_public_chat;
-wr_chat_t							*wr_private_chat;
-wr_uid_t							wr_private_chat_invite_uid;
+#define WR_CHAT_DEFERRED_MESSAGES_MAX		100
 
-static wi_mutable_dictionary_t		*wr_chats;
+
+wr_uid_t							wr_private_chat_invite_uid;
 
 static wi_runtime_id_t				wr_chat_runtime_id = WI_RUNTIME_ID_NULL;
 static wi_runtime_class_t			wr_chat_runtime_class = {
@@ -73,24 +79,6 @@ static wi_runtime_class_t			wr_chat_runtime_class = {
 
 void wr_chats_init(void) {
 	wr_chat_runtime_id = wi_runtime_register_class(&wr_chat_runtime_class);
-
-	wr_chats = wi_dictionary_init(wi_mutable_dictionary_alloc());
-	
-	wr_public_chat = wr_chat_init_public_chat(wr_chat_alloc());
-	wr_chats_add_chat(wr_public_chat);
-}
-
-
-
-void wr_chats_clear(void) {
-	wi_mutable_dictionary_remove_all_data(wr_chats);
-	wr_chat_remove_all_users(wr_public_chat);
-	wr_chats_add_chat(wr_public_chat);
-	
-	wi_release(wr_private_chat);
-	wr_private_chat = NULL;
-	
-	wr_private_chat_invite_uid = 0;
 }
 
 
@@ -98,19 +86,45 @@ void wr_chats_clear(void) {
 #pragma mark -
 
 void wr_chats_add_chat(wr_chat_t *chat) {
-	wi_mutable_dictionary_set_data_for_key(wr_chats, chat, wi_number_with_integer(chat->cid));
+	wr_intmap_set_data_for_key(wr_connection->chats, chat, chat->cid);
 }
 
 
 
 void wr_chats_remove_chat(wr_chat_t *chat) {
-	wi_mutable_dictionary_remove_data_for_key(wr_chats, wi_number_with_integer(chat->cid));
+	wr_intmap_remove_data_for_key(wr_connection->chats, chat->cid);
 }
 
 
 
 wr_chat_t * wr_chats_chat_with_cid(wr_cid_t cid) {
-	return wi_dictionary_data_for_key(wr_chats, wi_number_with_integer(cid));
+	return wr_intmap_data_for_key(wr_connection->chats, cid);
+}
+
+
+
+void wr_chats_rename_user(wr_user_t *user, wi_string_t *nick) {
+	wi_enumerator_t		*enumerator;
+	wi_array_t			*chats;
+	wr_chat_t			*chat;
+
+	// the user is shared between chats, move it in every nick index
+	chats		= wr_intmap_all_data(wr_connection->chats);
+	enumerator	= wi_array_data_enumerator(chats);
+
+	while((chat = wi_enumerator_next_data(enumerator))) {
+		if(wr_intmap_data_for_key(chat->users_by_uid, wr_user_id(user)))
+			wr_chat_unindex_user_nick(chat, user, wr_user_nick(user));
+	}
+
+	wr_user_set_nick(user, nick);
+
+	enumerator	= wi_array_data_enumerator(chats);
+
+	while((chat = wi_enumerator_next_data(enumerator))) {
+		if(wr_intmap_data_for_key(chat->users_by_uid, wr_user_id(user)))
+			wr_chat_index_user_nick(chat, user, nick);
+	}
 }
 
 
@@ -125,7 +139,8 @@ wr_chat_t * wr_chat_alloc(void) {
 
 wr_chat_t * wr_chat_init(wr_chat_t *chat) {
 	chat->users_array			= wi_array_init(wi_mutable_array_alloc());
-	chat->users_dictionary		= wi_dictionary_init(wi_mutable_dictionary_alloc());
+	chat->users_by_uid			= wr_intmap_create(0);
+	chat->users_by_nick			= wi_dictionary_init(wi_mutable_dictionary_alloc());
 	
 	return chat;
 }
@@ -154,7 +169,10 @@ static void wr_chat_dealloc(wi_runtime_instance_t *instance) {
 	wr_chat_t		*chat = instance;
 	
 	wi_release(chat->users_array);
-	wi_release(chat->users_dictionary);
+	wr_intmap_destroy(chat->users_by_uid);
+	wi_release(chat->users_by_nick);
+	wi_release(chat->listed_users);
+	wi_release(chat->deferred_messages);
 }
 
 
@@ -206,50 +224,205 @@ wi_array_t * wr_chat_users(wr_chat_t *chat) {
 
 void wr_chat_add_user(wr_chat_t *chat, wr_user_t *user) {
 	wi_mutable_array_add_data(chat->users_array, user);
-	wi_mutable_dictionary_set_data_for_key(chat->users_dictionary, user, wi_number_with_integer(wr_user_id(user)));
+	wr_intmap_set_data_for_key(chat->users_by_uid, user, wr_user_id(user));
+	wr_chat_index_user_nick(chat, user, wr_user_nick(user));
 }
 
 
 
 void wr_chat_remove_user(wr_chat_t *chat, wr_user_t *user) {
+	if(chat->listed_users)
+		wi_mutable_array_remove_data(chat->listed_users, user);
+
 	wi_mutable_array_remove_data(chat->users_array, user);
-	wi_mutable_dictionary_remove_data_for_key(chat->users_dictionary, wi_number_with_integer(wr_user_id(user)));
+	wr_intmap_remove_data_for_key(chat->users_by_uid, wr_user_id(user));
+	wr_chat_unindex_user_nick(chat, user, wr_user_nick(user));
 }
 
 
 
 void wr_chat_remove_all_users(wr_chat_t *chat) {
 	wi_mutable_array_remove_all_data(chat->users_array);
-	wi_mutable_dictionary_remove_all_data(chat->users_dictionary);
+	wr_intmap_remove_all_data(chat->users_by_uid);
+	wi_mutable_dictionary_remove_all_data(chat->users_by_nick);
+
+	// the next user list fills the chat again from scratch
+	wi_release(chat->listed_users);
+	wi_release(chat->deferred_messages);
+
+	chat->listed_users		= NULL;
+	chat->deferred_messages	= NULL;
+	chat->loaded			= false;
+}
+
+
+
+#pragma mark -
+
+void wr_chat_add_listed_user(wr_chat_t *chat, wr_user_t *user) {
+	if(!chat->listed_users)
+		chat->listed_users = wi_array_init_with_capacity(wi_mutable_array_alloc(), 100);
+
+	wi_mutable_array_add_data(chat->listed_users, user);
+}
+
+
+
+void wr_chat_finish_user_list(wr_chat_t *chat) {
+	wi_enumerator_t		*enumerator;
+	wi_array_t			*users;
+	wr_user_t			*user;
+	wi_uinteger_t		count;
+
+	users = chat->listed_users;
+
+	if(users) {
+		count = wi_array_count(chat->users_array) + wi_array_count(users);
+
+		// size the uid table once for the whole list instead of growing it
+		wr_intmap_destroy(chat->users_by_uid);
+		chat->users_by_uid = wr_intmap_create(count);
+
+		enumerator = wi_array_data_enumerator(chat->users_array);
+
+		while((user = wi_enumerator_next_data(enumerator)))
+			wr_intmap_set_data_for_key(chat->users_by_uid, user, wr_user_id(user));
+
+		// usually nobody joined while the list came in, take it as is
+		if(wi_array_count(chat->users_array) == 0) {
+			wi_release(chat->users_array);
+			chat->users_array = wi_retain(users);
+		}
+
+		enumerator = wi_array_data_enumerator(users);
+
+		while((user = wi_enumerator_next_data(enumerator))) {
+			if(users != chat->users_array) {
+				if(wr_intmap_data_for_key(chat->users_by_uid, wr_user_id(user)))
+					continue;
+
+				wi_mutable_array_add_data(chat->users_array, user);
+			}
+
+			wr_intmap_set_data_for_key(chat->users_by_uid, user, wr_user_id(user));
+			wr_chat_index_user_nick(chat, user, wr_user_nick(user));
+		}
+
+		wi_release(chat->listed_users);
+		chat->listed_users = NULL;
+	}
+
+	chat->loaded = true;
+}
+
+
+
+wi_boolean_t wr_chat_is_loaded(wr_chat_t *chat) {
+	return chat->loaded;
+}
+
+
+
+void wr_chat_defer_message(wr_chat_t *chat, wi_p7_message_t *message) {
+	if(!chat->deferred_messages)
+		chat->deferred_messages = wi_array_init(wi_mutable_array_alloc());
+
+	// a chat that never finishes its list must not hold on to everything
+	if(wi_array_count(chat->deferred_messages) >= WR_CHAT_DEFERRED_MESSAGES_MAX) {
+		wi_log_warn(WI_STR("Too many messages waiting for the user list of chat %u, dropping the oldest"),
+			chat->cid);
+
+		wi_mutable_array_remove_data_at_index(chat->deferred_messages, 0);
+	}
+
+	wi_mutable_array_add_data(chat->deferred_messages, message);
+}
+
+
+
+wi_array_t * wr_chat_take_deferred_messages(wr_chat_t *chat) {
+	wi_array_t		*messages;
+
+	messages = chat->deferred_messages;
+
+	if(!messages)
+		return NULL;
+
+	chat->deferred_messages = NULL;
+
+	return wi_autorelease(messages);
 }
 
 
 
 wr_user_t * wr_chat_user_with_uid(wr_chat_t *chat, wr_uid_t uid) {
-	return wi_dictionary_data_for_key(chat->users_dictionary, wi_number_with_integer(uid));
+	return wr_intmap_data_for_key(chat->users_by_uid, uid);
 }
 
 
 
 wr_user_t * wr_chat_user_with_nick(wr_chat_t *chat, wi_string_t *nick) {
-	wi_enumerator_t	*enumerator;
+	wi_array_t		*users;
 	wi_string_t		*name;
-	wr_user_t       *user, *value = NULL;
+	const char		*cstring;
 	char			*cname;
 
-	cname = ((*rl_filename_dequoting_function) ((char *) wi_string_cstring(nick), 0));
-	name = wi_string_with_cstring(cname);
-	free(cname);
+	// only nicks typed with escapes need dequoting, which allocates
+	cstring = wi_string_cstring(nick);
 
-	enumerator = wi_array_data_enumerator(chat->users_array);
-	
-	while((user = wi_enumerator_next_data(enumerator))) {
-		if(wi_is_equal(wr_user_nick(user), name)) {
-			value = user;
+	if(strchr(cstring, '\\')) {
+		cname = ((*rl_filename_dequoting_function) ((char *) cstring, 0));
+		name = wi_string_with_cstring(cname);
+		free(cname);
+	} else {
+		name = nick;
+	}
 
-			break;
-		}
+	users = wi_dictionary_data_for_key(chat->users_by_nick, name);
+
+	if(!users || wi_array_count(users) == 0)
+		return NULL;
+
+	// nicks are not unique, the user who took it first wins as before
+	return wi_array_first_data(users);
+}
+
+
+
+#pragma mark -
+
+static void wr_chat_index_user_nick(wr_chat_t *chat, wr_user_t *user, wi_string_t *nick) {
+	wi_mutable_array_t		*users;
+
+	if(!nick)
+		return;
+
+	users = wi_dictionary_data_for_key(chat->users_by_nick, nick);
+
+	if(!users) {
+		users = wi_array_init_with_capacity(wi_mutable_array_alloc(), 1);
+		wi_mutable_dictionary_set_data_for_key(chat->users_by_nick, users, nick);
+		wi_release(users);
 	}
 
-	return value;
+	wi_mutable_array_add_data(users, user);
+}
+
+
+
+static void wr_chat_unindex_user_nick(wr_chat_t *chat, wr_user_t *user, wi_string_t *nick) {
+	wi_mutable_array_t		*users;
+
+	if(!nick)
+		return;
+
+	users = wi_dictionary_data_for_key(chat->users_by_nick, nick);
+
+	if(!users)
+		return;
+
+	wi_mutable_array_remove_data(users, user);
+
+	if(wi_array_count(users) == 0)
+		wi_mutable_dictionary_remove_data_for_key(chat->users_by_nick, nick);
 }
@@ -31,17 +31,19 @@
 
 #include "users.h"
 
+#define WR_PUBLIC_CID				1
+
 typedef uint32_t					wr_cid_t;
 
 typedef struct _wr_chat				wr_chat_t;
 
 
 void								wr_chats_init(void);
-void								wr_chats_clear(void);
 
 void								wr_chats_add_chat(wr_chat_t *);
 void								wr_chats_remove_chat(wr_chat_t *);
 wr_chat_t *							wr_chats_chat_with_cid(wr_cid_t);
+void								wr_chats_rename_user(wr_user_t *, wi_string_t *);
 
 wr_chat_t *							wr_chat_alloc(void);
 wr_chat_t *							wr_chat_init(wr_chat_t *);
@@ -57,8 +59,13 @@ void								wr_chat_remove_all_users(wr_chat_t *);
 wr_user_t *							wr_chat_user_with_uid(wr_chat_t *, wr_uid_t);
 wr_user_t *							wr_chat_user_with_nick(wr_chat_t *, wi_string_t *);
 
+void								wr_chat_add_listed_user(wr_chat_t *, wr_user_t *);
+void								wr_chat_finish_user_list(wr_chat_t *);
+wi_boolean_t						wr_chat_is_loaded(wr_chat_t *);
+void								wr_chat_defer_message(wr_chat_t *, wi_p7_message_t *);
+wi_array_t *						wr_chat_take_deferred_messages(wr_chat_t *);
+
 
-extern wr_chat_t					*wr_public_chat;
 extern wr_uid_t						wr_private_chat_invite_uid;
 
 #endif /* WR_CHATS_H */
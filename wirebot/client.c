@@ -28,11 +28,20 @@
 
 #include "config.h"
 
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <errno.h>
+#include <math.h>
+#include <string.h>
+#include <time.h>
 #include <wired/wired.h>
 
 #include "main.h"
 #include "client.h"
 #include "commands.h"
+#include "connection.h"
 #include "ignores.h"
 #include "main.h"
 #include "messages.h"
@@ -41,13 +50,31 @@
 #include "users.h"
 #include "windows.h"
 #include "settings.h"
+#include "listings.h"
+#include "snapshot.h"
 
-static wr_server_t *				wr_client_login(wi_p7_socket_t *, wi_string_t *, wi_string_t *);
+static wi_array_t *					wr_client_connect_messages(wr_connection_t *);
+static wr_connection_t *			wr_client_connect_attempt(wr_connection_t *);
+static wi_boolean_t					wr_client_open(wr_connection_t *);
+static void							wr_client_finish_connect(wr_connection_t *, wr_connection_t *);
+static void							wr_client_connect_thread(wi_runtime_instance_t *);
+
+static wr_server_t *				wr_client_login(wr_connection_t *, wi_p7_socket_t *, wi_array_t *);
 
 static wi_p7_message_t *			wr_client_info_message(void);
 
-static wi_p7_message_t *			wr_client_read_message(wi_p7_socket_t *);
-static wi_boolean_t					wr_client_write_message(wi_p7_socket_t *, wi_p7_message_t *);
+static wi_p7_message_t *			wr_client_read_message(wr_connection_t *, wi_p7_socket_t *);
+static wi_boolean_t					wr_client_write_message(wr_connection_t *, wi_p7_socket_t *, wi_p7_message_t *);
+
+static wi_p7_options_t				wr_client_transport_options(void);
+static wi_string_t *				wr_client_transport_description(wi_p7_options_t);
+static wi_time_interval_t			wr_client_cpu_time(void);
+
+static void							wr_client_set_socket_options(wi_socket_t *);
+static void							wr_client_reset_keepalive(wr_connection_t *);
+static wi_time_interval_t			wr_client_dead_peer_timeout(wr_connection_t *);
+static wi_time_interval_t			wr_client_connection_timeout(wr_connection_t *, wi_time_interval_t);
+static void							wr_client_connection_keepalive(wr_connection_t *, wi_time_interval_t);
 
 static wi_boolean_t					wr_runloop_server_callback(wi_socket_t *);
 
@@ -106,16 +133,13 @@ wi_data_t							*wr_icon;
 wi_string_t							*wr_icon_path;
 wi_string_t							*wr_timestamp_format;
 
-wr_server_t							*wr_server;
+static wi_p7_uint32_t				wr_client_transaction;
+static wi_lock_t					*wr_client_lock;
 
-wi_socket_t							*wr_socket;
-wi_p7_socket_t						*wr_p7_socket;
+wi_boolean_t						wr_client_instrument_transport;
 
-wi_string_t							*wr_password;
-
-wi_boolean_t						wr_connected;
-wi_boolean_t						wr_reconnecting;
-wi_p7_uint32_t						wb_user_id;
+static const double					wr_client_rtt_buckets[WR_CONNECTION_RTT_BUCKETS - 1] =
+	{ 0.001, 0.005, 0.010, 0.025, 0.050, 0.100, 0.250, 0.500, 1.0, 2.5, 5.0 };
 
 
 void wr_client_init(void) {
@@ -137,6 +161,10 @@ void wr_client_init(void) {
 	if(!wr_nick)
 		wr_nick = wi_retain(wi_user_name());
 
+	wr_client_instrument_transport = wi_config_bool_for_name(wd_config, WI_STR("transport instrumentation"));
+	
+	wr_client_lock = wi_lock_init(wi_lock_alloc());
+
 	// if(!wr_icon)
 	// 	wr_icon = wi_data_init_with_base64(wi_data_alloc(), wi_string_with_cstring(wr_default_icon));
 
@@ -174,34 +202,83 @@ wi_boolean_t wr_client_set_charset(wi_string_t *charset) {
 
 #pragma mark -
 
-void wr_client_connect(wi_string_t *hostname, wi_uinteger_t port, wi_string_t *login, wi_string_t *password) {
+wi_boolean_t wr_client_connect(wr_connection_t *connection) {
+	wr_connection_t		*attempt;
+	
+	attempt = wr_client_connect_attempt(connection);
+	
+	if(!wr_client_open(attempt))
+		return false;
+	
+	wr_client_finish_connect(connection, attempt);
+	
+	return true;
+}
+
+
+
+static wi_array_t * wr_client_connect_messages(wr_connection_t *connection) {
+	wi_mutable_array_t	*messages;
+	wi_p7_message_t		*message;
+	
+	// messages sent right after the login, in the same burst: the server
+	// handles them in order, so they need not wait for the login reply
+	messages = wi_mutable_array();
+	
+	message = wi_p7_message_with_name(WI_STR("wired.chat.join_chat"), wr_p7_spec);
+	wi_p7_message_set_uint32_for_name(message, wr_chat_id(connection->public_chat), WI_STR("wired.chat.id"));
+	wi_mutable_array_add_data(messages, message);
+	
+	// suscribe bot watchers, they live on the first server only
+	if(wb_bot && connection == wr_connections_first())
+		wi_mutable_array_add_data_from_array(messages, wb_bot_subscribe_watchers_messages(wb_bot));
+	
+	return messages;
+}
+
+
+
+static wr_connection_t * wr_client_connect_attempt(wr_connection_t *connection) {
+	wr_connection_t		*attempt;
+	
+	// a scratch connection to the same server that the connect fills in,
+	// so a reconnect thread never touches one the runloop is serving; the
+	// messages and options are taken here, on the runloop
+	attempt = wi_autorelease(wr_connection_init_with_address(wr_connection_alloc(),
+		connection->hostname, connection->port, connection->login, connection->password));
+	
+	attempt->connect_messages	= wi_retain(wr_client_connect_messages(connection));
+	attempt->connect_options	= wr_client_transport_options();
+	
+	return attempt;
+}
+
+
+
+static wi_boolean_t wr_client_open(wr_connection_t *connection) {
 	wi_enumerator_t		*enumerator;
 	wi_array_t			*addresses;
 	wi_address_t		*address;
 	wi_p7_socket_t		*p7_socket;
-	wi_p7_message_t		*message;
 	wi_socket_t			*socket;
 	wi_string_t			*ip;
 	wr_server_t			*server;
+	wi_time_interval_t	interval;
+	wi_p7_options_t		options;
 	
-	wi_log_info(WI_STR("Connecting to %@..."), hostname);
+	// this runs on a scratch connection, on a reconnect thread or not, and
+	// fills in its connect_* fields for wr_client_finish_connect()
+	wi_log_info(WI_STR("Connecting to %@..."), connection->hostname);
 	
-	if(port == 0)
-		port = WR_PORT;
+	options = connection->connect_options;
 	
-	if(!login)
-		login = WI_STR("guest");
-	
-	if(!password)
-		password = WI_STR("");
-	
-	addresses = wi_host_addresses(wi_host_with_string(hostname));
+	addresses = wi_host_addresses(wi_host_with_string(connection->hostname));
 	
 	if(!addresses) {
 		wi_log_info(WI_STR("Could not resolve \"%@\": %m"),
-			hostname);
+			connection->hostname);
 		
-		return;
+		return false;
 	}
 	
 	enumerator = wi_array_data_enumerator(addresses);
@@ -209,9 +286,9 @@ void wr_client_connect(wi_string_t *hostname, wi_uinteger_t port, wi_string_t *l
 	while((address = wi_enumerator_next_data(enumerator))) {
 		ip = wi_address_string(address);
 
-		wi_log_info(WI_STR("Trying %@ at port %u..."), ip, port);
+		wi_log_info(WI_STR("Trying %@ at port %u..."), ip, connection->port);
 		
-		wi_address_set_port(address, port);
+		wi_address_set_port(address, connection->port);
 		
 		socket = wi_autorelease(wi_socket_init_with_address(wi_socket_alloc(), address, WI_SOCKET_TCP));
 		
@@ -222,6 +299,7 @@ void wr_client_connect(wi_string_t *hostname, wi_uinteger_t port, wi_string_t *l
 		}
 		
 		wi_socket_set_interactive(socket, true);
+		wr_client_set_socket_options(socket);
 		
 		if(!wi_socket_connect(socket, 10.0)) {
 			wi_log_info(WI_STR("Could not connect to %@: %m"), ip);
@@ -233,81 +311,174 @@ void wr_client_connect(wi_string_t *hostname, wi_uinteger_t port, wi_string_t *l
 		
 		if(!wi_p7_socket_connect(p7_socket,
 								 10.0,
-								 WI_P7_COMPRESSION_DEFLATE | WI_P7_ENCRYPTION_RSA_AES256_SHA1 | WI_P7_CHECKSUM_SHA1,
+								 options,
 								 WI_P7_BINARY,
-								 login,
-								 wi_string_sha1(password))) {
+								 connection->login,
+								 wi_string_sha1(connection->password))) {
 			wi_log_info(WI_STR("Could not connect to %@: %m"), ip);
 			
 			continue;
 		}
 		
-		wi_log_info(WI_STR("Connected using %@/%u bits, logging in..."),
-			wi_cipher_name(wi_p7_socket_cipher(p7_socket)),
-			wi_cipher_bits(wi_p7_socket_cipher(p7_socket)));
+		if(wi_p7_socket_cipher(p7_socket)) {
+			wi_log_info(WI_STR("Connected using %@/%u bits (%@), logging in..."),
+				wi_cipher_name(wi_p7_socket_cipher(p7_socket)),
+				wi_cipher_bits(wi_p7_socket_cipher(p7_socket)),
+				wr_client_transport_description(options));
+		} else {
+			wi_log_info(WI_STR("Connected without encryption (%@), logging in..."),
+				wr_client_transport_description(options));
+		}
 		
-		server = wr_client_login(p7_socket, login, password);
+		interval = wi_time_interval();
+		server = wr_client_login(connection, p7_socket, connection->connect_messages);
 		
 		if(!server)
 			break;
 
-		wi_log_info(WI_STR("Logged in, welcome to %@"), wr_server_name(server));
-		
-		message = wi_p7_message_with_name(WI_STR("wired.chat.join_chat"), wr_p7_spec);
-		wi_p7_message_set_uint32_for_name(message, wr_chat_id(wr_public_chat), WI_STR("wired.chat.id"));
-		wr_client_write_message(p7_socket, message);
+		wi_log_info(WI_STR("Logged in to %@ after %.3f seconds, welcome to %@"),
+			connection->name, wi_time_interval() - interval, wr_server_name(server));
 		
-		wr_connected	= true;
-		wr_socket		= wi_retain(socket);
-		wr_p7_socket	= wi_retain(p7_socket);
-		wr_server		= wi_retain(server);
-		wr_password		= wi_retain(password);
+		connection->connect_socket		= wi_retain(socket);
+		connection->connect_p7_socket	= wi_retain(p7_socket);
+		connection->connect_server		= wi_retain(server);
 		
-		wi_socket_set_direction(wr_socket, WI_SOCKET_READ);
-		wr_runloop_add_socket(wr_socket, &wr_runloop_server_callback);
-
-		// suscribe bot watchers
-		wb_bot_subscribe_watchers(wb_bot);
-		
-		break;
+		return true;
 	}
+	
+	return false;
 }
 
 
-void wr_client_reconnect(void) {
-	wr_connected 	= false;
-	wr_reconnecting = true;
 
-	wi_log_info(WI_STR("Reconnecting in 10 seconds..."));
+static void wr_client_finish_connect(wr_connection_t *connection, wr_connection_t *attempt) {
+	wi_release(connection->socket);
+	wi_release(connection->p7_socket);
+	wi_release(connection->server);
+	
+	connection->connected		= true;
+	connection->socket			= attempt->connect_socket;
+	connection->p7_socket		= attempt->connect_p7_socket;
+	connection->server			= attempt->connect_server;
+	connection->user_id			= attempt->user_id;
+	connection->connect_time	= wi_time_interval();
+	connection->connects++;
+	
+	attempt->connect_socket		= NULL;
+	attempt->connect_p7_socket	= NULL;
+	attempt->connect_server		= NULL;
+	
+	// the login counts as transport of this connection
+	connection->transport_options	= attempt->connect_options;
+	connection->transport_reads		+= attempt->transport_reads;
+	connection->transport_writes	+= attempt->transport_writes;
+	connection->read_cpu_time		+= attempt->read_cpu_time;
+	connection->verify_cpu_time		+= attempt->verify_cpu_time;
+	connection->write_cpu_time		+= attempt->write_cpu_time;
+	
+	wi_socket_set_direction(connection->socket, WI_SOCKET_READ);
+	wr_runloop_add_socket(connection->socket, &wr_runloop_server_callback);
+	
+	wr_client_reset_keepalive(connection);
+}
+
 
-	sleep(10);
+
+static void wr_client_connect_thread(wi_runtime_instance_t *argument) {
+	wr_connection_t		*attempt = argument;
+	wi_pool_t			*pool;
+	
+	pool = wi_pool_init(wi_pool_alloc());
+	
+	wr_client_open(attempt);
+	
+	wi_lock_lock(wr_client_lock);
+	attempt->connect_done = true;
+	wi_lock_unlock(wr_client_lock);
+	
+	wi_release(pool);
 	
-	wr_client_connect(wb_hostname, wb_port, wb_login, wb_password);
+	wr_runloop_wakeup();
+}
+
+
 
-	wr_reconnecting = false;
+void wr_client_connect_all(void) {
+	wr_connection_t		*connection, *current;
+	wi_uinteger_t		i, count;
+	
+	current	= wr_connection;
+	count	= wi_array_count(wr_connections);
+	
+	for(i = 0; i < count; i++) {
+		connection = WI_ARRAY(wr_connections, i);
+		wr_connection = connection;
+		
+		if(!wr_client_connect(connection))
+			wr_client_reconnect(connection);
+	}
+	
+	wr_connection = current;
 }
 
 
 
-void wr_client_disconnect(void) {
-	if(wr_connected) {
+void wr_client_reconnect(wr_connection_t *connection) {
+	if(!wi_config_bool_for_name(wd_config, WI_STR("auto reconnect")))
+		return;
+	
+	connection->connected		= false;
+	connection->reconnecting	= true;
+	connection->reconnect_time	= wi_time_interval() + WR_CONNECTION_RECONNECT_DELAY;
+
+	// the other servers keep being served while this one waits, the
+	// attempt itself is made from wr_client_keepalive()
+	wi_log_info(WI_STR("Reconnecting to %@ in %.0f seconds..."),
+		connection->name, WR_CONNECTION_RECONNECT_DELAY);
+}
+
+
+
+void wr_client_disconnect(wr_connection_t *connection) {
+	if(connection->connected) {
 		wi_log_info(WI_STR("Connection to %@ closed"),
-			wi_address_string(wi_socket_address(wr_socket)));
+			wi_address_string(wi_socket_address(connection->socket)));
 
-		wr_connected = false;
+		connection->connected = false;
 	}
 	
-	wr_runloop_remove_socket(wr_socket);
-	wi_socket_close(wr_socket);
-	wi_release(wr_p7_socket);
-	wi_release(wr_socket);
-
-	wi_release(wr_server);
+	if(connection->socket) {
+		wr_runloop_remove_socket(connection->socket);
+		wi_socket_close(connection->socket);
+	}
+	
+	wi_release(connection->p7_socket);
+	connection->p7_socket = NULL;
 	
-	wi_release(wr_password);
+	wi_release(connection->socket);
+	connection->socket = NULL;
 
-	wr_chats_clear();
+	wi_release(connection->server);
+	connection->server = NULL;
+	
+	wr_connection_clear_chats(connection);
 	wr_users_clear();
+
+	if(connection == wr_connections_first()) {
+		wb_listings_reset();
+		wb_snapshots_discard();
+	}
+}
+
+
+
+void wr_client_disconnect_all(void) {
+	wi_uinteger_t		i, count;
+	
+	count = wi_array_count(wr_connections);
+	
+	for(i = 0; i < count; i++)
+		wr_client_disconnect(WI_ARRAY(wr_connections, i));
 }
 
 
@@ -315,7 +486,46 @@ void wr_client_disconnect(void) {
 #pragma mark -
 
 void wr_client_send_message(wi_p7_message_t *message) {
-	wr_client_write_message(wr_p7_socket, message);
+	wr_client_send_message_on_connection(wr_connection, message);
+}
+
+
+
+void wr_client_send_message_on_connection(wr_connection_t *connection, wi_p7_message_t *message) {
+	if(!connection || !connection->p7_socket)
+		return;
+	
+	if(wr_client_write_message(connection, connection->p7_socket, message))
+		connection->messages_sent++;
+}
+
+
+
+void wr_client_broadcast_message(wi_p7_message_t *message) {
+	wr_connection_t		*connection;
+	wi_uinteger_t		i, count;
+	
+	count = wi_array_count(wr_connections);
+	
+	for(i = 0; i < count; i++) {
+		connection = WI_ARRAY(wr_connections, i);
+		
+		if(connection->connected)
+			wr_client_send_message_on_connection(connection, message);
+	}
+}
+
+
+
+wi_p7_uint32_t wr_client_next_transaction(void) {
+	wi_p7_uint32_t		transaction;
+	
+	// reconnect threads log in with transactions of their own
+	wi_lock_lock(wr_client_lock);
+	transaction = ++wr_client_transaction;
+	wi_lock_unlock(wr_client_lock);
+	
+	return transaction;
 }
 
 
@@ -328,118 +538,130 @@ void wr_client_reply_message(wi_p7_message_t *reply, wi_p7_message_t *message) {
 			wi_p7_message_set_uint32_for_name(reply, transaction, WI_STR("wired.transaction"));
 	}
 	
-	wr_client_write_message(wr_p7_socket, reply);
+	wr_client_send_message(reply);
 }
 
 
 
 #pragma mark -
 
-static wr_server_t * wr_client_login(wi_p7_socket_t *p7_socket, wi_string_t *login, wi_string_t *password) {
+static wr_server_t * wr_client_login(wr_connection_t *connection, wi_p7_socket_t *p7_socket, wi_array_t *messages) {
+	wi_enumerator_t		*enumerator;
 	wi_p7_message_t		*message;
-	wi_string_t			*error;
+	wi_string_t			*name, *error;
 	wr_server_t			*server;
+	wi_p7_uint32_t		transaction, nick_transaction, status_transaction, icon_transaction, login_transaction;
+	wi_boolean_t		logged_in, privileged;
 	
-	if(!wr_client_write_message(p7_socket, wr_client_info_message()))
+	// write the whole login sequence back-to-back, the replies are matched
+	// by transaction afterwards
+	if(!wr_client_write_message(connection, p7_socket, wr_client_info_message()))
 		return NULL;
 	
-	message = wr_client_read_message(p7_socket);
-	
-	if(!message)
-		return NULL;
+	nick_transaction = wr_client_next_transaction();
 	
-	if(!wi_is_equal(wi_p7_message_name(message), WI_STR("wired.server_info"))) {
-		wr_printf_prefix(WI_STR("Could not login: Received unexpected message \"%@\" (expected wired.server_info)"),
-			wi_p7_message_name(message));
-		
-		return NULL;
-	}
-	
-	server = wr_server_with_message(message);
-
 	message = wi_p7_message_with_name(WI_STR("wired.user.set_nick"), wr_p7_spec);
 	wi_p7_message_set_string_for_name(message, wr_nick, WI_STR("wired.user.nick"));
+	wi_p7_message_set_uint32_for_name(message, nick_transaction, WI_STR("wired.transaction"));
 	
-	if(!wr_client_write_message(p7_socket, message))
+	if(!wr_client_write_message(connection, p7_socket, message))
 		return NULL;
 	
-	message = wr_client_read_message(p7_socket);
-	
-	if(!message)
-		return NULL;
+	status_transaction = 0;
 	
 	if(wr_status) {
+		status_transaction = wr_client_next_transaction();
+		
 		message = wi_p7_message_with_name(WI_STR("wired.user.set_status"), wr_p7_spec);
 		wi_p7_message_set_string_for_name(message, wr_status, WI_STR("wired.user.status"));
+		wi_p7_message_set_uint32_for_name(message, status_transaction, WI_STR("wired.transaction"));
 		
-		if(!wr_client_write_message(p7_socket, message))
-			return NULL;
-		
-		message = wr_client_read_message(p7_socket);
-		
-		if(!message)
+		if(!wr_client_write_message(connection, p7_socket, message))
 			return NULL;
 	}
 	
+	icon_transaction = wr_client_next_transaction();
+	
 	message = wi_p7_message_with_name(WI_STR("wired.user.set_icon"), wr_p7_spec);
 	wi_p7_message_set_data_for_name(message, wr_icon, WI_STR("wired.user.icon"));
+	wi_p7_message_set_uint32_for_name(message, icon_transaction, WI_STR("wired.transaction"));
 	
-	if(!wr_client_write_message(p7_socket, message))
+	if(!wr_client_write_message(connection, p7_socket, message))
 		return NULL;
 	
-	message = wr_client_read_message(p7_socket);
-	
-	if(!message)
-		return NULL;
+	login_transaction = wr_client_next_transaction();
 	
 	message = wi_p7_message_with_name(WI_STR("wired.send_login"), wr_p7_spec);
-	wi_p7_message_set_string_for_name(message, login, WI_STR("wired.user.login"));
-	wi_p7_message_set_string_for_name(message, wi_string_sha1(password), WI_STR("wired.user.password"));
+	wi_p7_message_set_string_for_name(message, connection->login, WI_STR("wired.user.login"));
+	wi_p7_message_set_string_for_name(message, wi_string_sha1(connection->password), WI_STR("wired.user.password"));
+	wi_p7_message_set_uint32_for_name(message, login_transaction, WI_STR("wired.transaction"));
 	
-	if(!wr_client_write_message(p7_socket, message))
+	if(!wr_client_write_message(connection, p7_socket, message))
 		return NULL;
 	
-	message = wr_client_read_message(p7_socket);
-	
-	if(!message)
-		return NULL;
-	
-	if(wi_is_equal(wi_p7_message_name(message), WI_STR("wired.error"))) {
-		error = wi_p7_message_enum_name_for_name(message, WI_STR("wired.error"));
-		
-		wr_printf_prefix(WI_STR("Could not login: Received error \"%@\""),
-			error);
-		
-		return NULL;
-	}
-	else if(!wi_is_equal(wi_p7_message_name(message), WI_STR("wired.login"))) {
-		wr_printf_prefix(WI_STR("Could not login: Received unexpected message \"%@\" (expected wired.login)"),
-			wi_p7_message_name(message));
+	if(messages) {
+		enumerator = wi_array_data_enumerator(messages);
 		
-		return NULL;
-	}
-	else {
-		wi_p7_message_get_uint32_for_name(message, &wb_user_id, WI_STR("wired.user.id"));
+		while((message = wi_enumerator_next_data(enumerator))) {
+			if(!wr_client_write_message(connection, p7_socket, message))
+				return NULL;
+		}
 	}
 	
-	message = wr_client_read_message(p7_socket);
-	
-	if(!message)
-		return NULL;
+	server		= NULL;
+	logged_in	= false;
+	privileged	= false;
 	
-	if(wi_is_equal(wi_p7_message_name(message), WI_STR("wired.error"))) {
-		error = wi_p7_message_enum_name_for_name(message, WI_STR("wired.error"));
+	while(!logged_in || !privileged) {
+		message = wr_client_read_message(connection, p7_socket);
 		
-		wr_printf_prefix(WI_STR("Could not login: Received error \"%@\""),
-			error);
+		if(!message || !wr_client_verify_message(connection, message))
+			return NULL;
 		
-		return NULL;
-	}
-	else if(!wi_is_equal(wi_p7_message_name(message), WI_STR("wired.account.privileges"))) {
-		wr_printf_prefix(WI_STR("Could not login: Received unexpected message \"%@\" (expected wired.account.privileges)"),
-			wi_p7_message_name(message));
+		name = wi_p7_message_name(message);
 		
-		return NULL;
+		if(!wi_p7_message_get_uint32_for_name(message, &transaction, WI_STR("wired.transaction")))
+			transaction = 0;
+		
+		if(wi_is_equal(name, WI_STR("wired.server_info"))) {
+			server = wr_server_with_message(message);
+		}
+		else if(wi_is_equal(name, WI_STR("wired.okay"))) {
+			continue;
+		}
+		else if(wi_is_equal(name, WI_STR("wired.error"))) {
+			error = wi_p7_message_enum_name_for_name(message, WI_STR("wired.error"));
+			
+			if(transaction == nick_transaction) {
+				wi_log_warn(WI_STR("Could not set nick: Received error \"%@\""), error);
+			}
+			else if(transaction != 0 && transaction == status_transaction) {
+				wi_log_warn(WI_STR("Could not set status: Received error \"%@\""), error);
+			}
+			else if(transaction == icon_transaction) {
+				wi_log_warn(WI_STR("Could not set icon: Received error \"%@\""), error);
+			}
+			else {
+				wr_printf_prefix(WI_STR("Could not login: Received error \"%@\""),
+					error);
+				
+				return NULL;
+			}
+		}
+		else if(server && wi_is_equal(name, WI_STR("wired.login"))) {
+			wi_p7_message_get_uint32_for_name(message, &connection->user_id, WI_STR("wired.user.id"));
+			
+			logged_in = true;
+		}
+		else if(logged_in && wi_is_equal(name, WI_STR("wired.account.privileges"))) {
+			privileged = true;
+		}
+		else {
+			wr_printf_prefix(WI_STR("Could not login: Received unexpected message \"%@\""),
+				name);
+			
+			return NULL;
+		}
 	}
 	
 	return server;
@@ -464,30 +686,74 @@ static wi_p7_message_t * wr_client_info_message(void) {
 
 
 
-static wi_p7_message_t * wr_client_read_message(wi_p7_socket_t *p7_socket) {
+static wi_p7_message_t * wr_client_read_message(wr_connection_t *connection, wi_p7_socket_t *p7_socket) {
 	wi_p7_message_t		*message;
+	wi_time_interval_t	time = 0.0;
+	wi_boolean_t		instrument;
+	
+	instrument = wr_client_instrument_transport;
+	
+	if(instrument)
+		time = wr_client_cpu_time();
 	
 	message = wi_p7_socket_read_message(p7_socket, 30.0);
 	
+	if(instrument) {
+		connection->read_cpu_time += wr_client_cpu_time() - time;
+		connection->transport_reads++;
+	}
+	
 	if(!message) {
 		wi_log_error(WI_STR("Could not read message from server: %m"));
 		
 		return NULL;
 	}
 	
+	return message;
+}
+
+
+
+wi_boolean_t wr_client_verify_message(wr_connection_t *connection, wi_p7_message_t *message) {
+	wi_time_interval_t	time = 0.0;
+	wi_boolean_t		instrument;
+	
+	instrument = wr_client_instrument_transport;
+	
+	if(instrument)
+		time = wr_client_cpu_time();
+	
 	if(!wi_p7_spec_verify_message(wr_p7_spec, message)) {
 		wi_log_error(WI_STR("Could not verify message from server: %m"));
 		
-		return NULL;
+		return false;
 	}
 	
-	return message;
+	if(instrument)
+		connection->verify_cpu_time += wr_client_cpu_time() - time;
+	
+	return true;
 }
 
 
 
-static wi_boolean_t wr_client_write_message(wi_p7_socket_t *p7_socket, wi_p7_message_t *message) {
-	if(!wi_p7_socket_write_message(p7_socket, 30.0, message)) {
+static wi_boolean_t wr_client_write_message(wr_connection_t *connection, wi_p7_socket_t *p7_socket, wi_p7_message_t *message) {
+	wi_time_interval_t	time = 0.0;
+	wi_boolean_t		result, instrument;
+	
+	instrument = wr_client_instrument_transport;
+	
+	if(instrument)
+		time = wr_client_cpu_time();
+	
+	result = wi_p7_socket_write_message(p7_socket, 30.0, message);
+	
+	if(instrument) {
+		connection->write_cpu_time += wr_client_cpu_time() - time;
+		connection->transport_writes++;
+	}
+	
+	if(!result) {
 		wr_printf_prefix(WI_STR("Could not write message to server: %m"));
 		
 		return false;
@@ -498,24 +764,461 @@ static wi_boolean_t wr_client_write_message(wi_p7_socket_t *p7_socket, wi_p7_mes
 
 
 
+#pragma mark -
+
+static wi_p7_options_t wr_client_transport_options(void) {
+	wi_string_t			*cipher, *checksum;
+	wi_p7_options_t		options;
+	
+	options		= 0;
+	cipher		= wi_config_string_for_name(wd_config, WI_STR("cipher"));
+	checksum	= wi_config_string_for_name(wd_config, WI_STR("checksum"));
+	
+	if(wi_config_bool_for_name(wd_config, WI_STR("compression")))
+		options |= WI_P7_COMPRESSION_DEFLATE;
+	
+	if(!cipher || wi_is_equal(cipher, WI_STR("aes256")))
+		options |= WI_P7_ENCRYPTION_RSA_AES256_SHA1;
+	else if(wi_is_equal(cipher, WI_STR("aes192")))
+		options |= WI_P7_ENCRYPTION_RSA_AES192_SHA1;
+	else if(wi_is_equal(cipher, WI_STR("aes128")))
+		options |= WI_P7_ENCRYPTION_RSA_AES128_SHA1;
+	else if(wi_is_equal(cipher, WI_STR("bf128")))
+		options |= WI_P7_ENCRYPTION_RSA_BF128_SHA1;
+	else if(wi_is_equal(cipher, WI_STR("3des192")))
+		options |= WI_P7_ENCRYPTION_RSA_3DES192_SHA1;
+	else if(!wi_is_equal(cipher, WI_STR("none"))) {
+		wi_log_warn(WI_STR("Unknown cipher \"%@\", using aes256"), cipher);
+		
+		options |= WI_P7_ENCRYPTION_RSA_AES256_SHA1;
+	}
+	
+	if(!checksum || wi_is_equal(checksum, WI_STR("sha1")))
+		options |= WI_P7_CHECKSUM_SHA1;
+	else if(wi_is_equal(checksum, WI_STR("sha256")))
+		options |= WI_P7_CHECKSUM_SHA256;
+	else if(!wi_is_equal(checksum, WI_STR("none"))) {
+		wi_log_warn(WI_STR("Unknown checksum \"%@\", using sha1"), checksum);
+		
+		options |= WI_P7_CHECKSUM_SHA1;
+	}
+	
+	return options;
+}
+
+
+
+static wi_string_t * wr_client_transport_description(wi_p7_options_t options) {
+	wi_string_t		*compression, *cipher, *checksum;
+	
+	compression = (options & WI_P7_COMPRESSION_DEFLATE) ? WI_STR("deflate") : WI_STR("no compression");
+	
+	if(options & WI_P7_ENCRYPTION_RSA_AES256_SHA1)
+		cipher = WI_STR("aes256");
+	else if(options & WI_P7_ENCRYPTION_RSA_AES192_SHA1)
+		cipher = WI_STR("aes192");
+	else if(options & WI_P7_ENCRYPTION_RSA_AES128_SHA1)
+		cipher = WI_STR("aes128");
+	else if(options & WI_P7_ENCRYPTION_RSA_BF128_SHA1)
+		cipher = WI_STR("bf128");
+	else if(options & WI_P7_ENCRYPTION_RSA_3DES192_SHA1)
+		cipher = WI_STR("3des192");
+	else
+		cipher = WI_STR("no cipher");
+	
+	if(options & WI_P7_CHECKSUM_SHA256)
+		checksum = WI_STR("sha256");
+	else if(options & WI_P7_CHECKSUM_SHA1)
+		checksum = WI_STR("sha1");
+	else
+		checksum = WI_STR("no checksum");
+	
+	return wi_string_with_format(WI_STR("%@, %@, %@"), compression, cipher, checksum);
+}
+
+
+
+static wi_time_interval_t wr_client_cpu_time(void) {
+#ifdef CLOCK_THREAD_CPUTIME_ID
+	struct timespec		ts;
+	
+	if(clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts) == 0)
+		return ts.tv_sec + ((double) ts.tv_nsec / 1000000000.0);
+#endif
+	
+	return (double) clock() / CLOCKS_PER_SEC;
+}
+
+
+
 #pragma mark -
 
 static wi_boolean_t wr_runloop_server_callback(wi_socket_t *socket) {
+	wr_connection_t		*connection, *current;
 	wi_p7_message_t		*message;
+	wi_time_interval_t	interval;
+	wi_boolean_t		result;
+	
+	connection = wr_connections_connection_with_socket(socket);
+	
+	if(!connection)
+		return false;
 	
-	message = wr_client_read_message(wr_p7_socket);
+	// everything dispatched from here on talks to this server
+	current			= wr_connection;
+	wr_connection	= connection;
+	result			= false;
+	
+	message = wr_client_read_message(connection, connection->p7_socket);
 	
 	if(message) {
-		wr_messages_handle_message(message);
+		interval = wi_time_interval();
 		
-		return true;
+		connection->last_read_time = interval;
+		connection->messages_received++;
+		
+		// handled messages are verified on dispatch, the others are dropped unchecked
+		if(wr_messages_handle_message(message)) {
+			connection->dispatch_time += wi_time_interval() - interval;
+			
+			result = true;
+		}
+	}
+	
+	if(!result) {
+		wr_client_disconnect(connection);
+		
+		if(!connection->reconnecting)
+			wr_client_reconnect(connection);
+	}
+	
+	wr_connection = current;
+	
+	return result;
+}
+
+
+
+#pragma mark -
+
+static void wr_client_set_socket_options(wi_socket_t *socket) {
+	wi_integer_t		timeout;
+	int					sd, value;
+	
+	sd		= wi_socket_descriptor(socket);
+	timeout	= wi_config_integer_for_name(wd_config, WI_STR("ping timeout"));
+	
+	if(wi_config_bool_for_name(wd_config, WI_STR("tcp keepalive"))) {
+		value = 1;
+		
+		if(setsockopt(sd, SOL_SOCKET, SO_KEEPALIVE, &value, sizeof(value)) < 0)
+			wi_log_warn(WI_STR("Could not set SO_KEEPALIVE: %s"), strerror(errno));
+
+#ifdef TCP_KEEPIDLE
+		value = WI_MAX(1, timeout);
+		
+		if(setsockopt(sd, IPPROTO_TCP, TCP_KEEPIDLE, &value, sizeof(value)) < 0)
+			wi_log_warn(WI_STR("Could not set TCP_KEEPIDLE: %s"), strerror(errno));
+#endif
+
+#ifdef TCP_KEEPINTVL
+		value = WI_MAX(1, timeout / 3);
+		
+		if(setsockopt(sd, IPPROTO_TCP, TCP_KEEPINTVL, &value, sizeof(value)) < 0)
+			wi_log_warn(WI_STR("Could not set TCP_KEEPINTVL: %s"), strerror(errno));
+#endif
+
+#ifdef TCP_KEEPCNT
+		value = 3;
+		
+		if(setsockopt(sd, IPPROTO_TCP, TCP_KEEPCNT, &value, sizeof(value)) < 0)
+			wi_log_warn(WI_STR("Could not set TCP_KEEPCNT: %s"), strerror(errno));
+#endif
+	}
+
+#ifdef TCP_USER_TIMEOUT
+	value = wi_config_integer_for_name(wd_config, WI_STR("tcp user timeout")) * 1000;
+	
+	if(value > 0) {
+		if(setsockopt(sd, IPPROTO_TCP, TCP_USER_TIMEOUT, &value, sizeof(value)) < 0)
+			wi_log_warn(WI_STR("Could not set TCP_USER_TIMEOUT: %s"), strerror(errno));
+	}
+#endif
+}
+
+
+
+static void wr_client_reset_keepalive(wr_connection_t *connection) {
+	connection->last_read_time	= wi_time_interval();
+	connection->ping_time		= 0.0;
+	connection->ping_interval	= wi_config_integer_for_name(wd_config, WI_STR("ping interval"));
+	
+	if(connection->ping_interval < WR_CLIENT_MIN_PING_INTERVAL)
+		connection->ping_interval = WR_CLIENT_MIN_PING_INTERVAL;
+}
+
+
+
+static wi_time_interval_t wr_client_dead_peer_timeout(wr_connection_t *connection) {
+	wi_time_interval_t		rto;
+	
+	// until a reply has been timed, wait "ping timeout"; after that wait
+	// for the estimated retransmission timeout, so a fast link is reported
+	// dead within a few seconds and a slow one is not reported too early
+	if(connection->rtt_count == 0)
+		return wi_config_integer_for_name(wd_config, WI_STR("ping timeout"));
+	
+	rto = connection->srtt + (4.0 * connection->rttvar);
+	
+	if(rto < WR_CLIENT_MIN_PING_TIMEOUT)
+		rto = WR_CLIENT_MIN_PING_TIMEOUT;
+	
+	return rto;
+}
+
+
+
+static wi_time_interval_t wr_client_connection_timeout(wr_connection_t *connection, wi_time_interval_t interval) {
+	// the reconnect thread wakes the runloop up when it is done
+	if(connection->connect_attempt)
+		return 30.0;
+	
+	if(connection->reconnecting)
+		return connection->reconnect_time - interval;
+	
+	if(!connection->connected)
+		return 30.0;
+	
+	if(connection->ping_time > 0.0)
+		return wr_client_dead_peer_timeout(connection) - (interval - connection->ping_time);
+	
+	return connection->ping_interval - (interval - connection->last_read_time);
+}
+
+
+
+static void wr_client_connection_keepalive(wr_connection_t *connection, wi_time_interval_t interval) {
+	wr_connection_t		*attempt;
+	wi_boolean_t		done;
+	
+	if(connection->connect_attempt) {
+		attempt = connection->connect_attempt;
+		
+		wi_lock_lock(wr_client_lock);
+		done = attempt->connect_done;
+		wi_lock_unlock(wr_client_lock);
+		
+		if(!done)
+			return;
+		
+		// the thread is done with the attempt, take what it got
+		if(attempt->connect_socket) {
+			wr_client_finish_connect(connection, attempt);
+			
+			connection->reconnecting = false;
+		} else {
+			connection->reconnect_time = wi_time_interval() + WR_CONNECTION_RECONNECT_DELAY;
+		}
+		
+		wi_release(attempt);
+		connection->connect_attempt = NULL;
+		
+		return;
+	}
+	
+	// connecting and logging in block for up to a minute, so the attempt is
+	// made on a thread of its own while the other servers keep being served
+	if(connection->reconnecting) {
+		if(interval >= connection->reconnect_time) {
+			connection->connect_attempt = wi_retain(wr_client_connect_attempt(connection));
+			
+			if(!wi_thread_create_thread(wr_client_connect_thread, connection->connect_attempt)) {
+				wi_log_warn(WI_STR("Could not create a thread to reconnect to %@: %m"), connection->name);
+				
+				wi_release(connection->connect_attempt);
+				connection->connect_attempt = NULL;
+				
+				connection->reconnect_time = wi_time_interval() + WR_CONNECTION_RECONNECT_DELAY;
+			}
+		}
+		
+		return;
+	}
+	
+	if(!connection->connected)
+		return;
+	
+	if(connection->ping_time > 0.0) {
+		if(interval - connection->ping_time > wr_client_dead_peer_timeout(connection)) {
+			wi_log_warn(WI_STR("No ping reply from %@ after %.1f seconds, closing connection"),
+				wi_address_string(wi_socket_address(connection->socket)),
+				interval - connection->ping_time);
+			
+			wr_client_disconnect(connection);
+			wr_client_reconnect(connection);
+		}
+	}
+	else if(interval - connection->last_read_time > connection->ping_interval) {
+		wr_client_send_message_on_connection(connection,
+			wi_p7_message_with_name(WI_STR("wired.send_ping"), wr_p7_spec));
+		
+		connection->ping_time = interval;
+	}
+}
+
+
+
+wi_time_interval_t wr_client_keepalive_timeout(void) {
+	wi_time_interval_t		interval, timeout, connection_timeout;
+	wi_uinteger_t			i, count;
+	
+	interval	= wi_time_interval();
+	timeout		= 30.0;
+	count		= wi_array_count(wr_connections);
+	
+	for(i = 0; i < count; i++) {
+		connection_timeout = wr_client_connection_timeout(WI_ARRAY(wr_connections, i), interval);
+		
+		if(connection_timeout < timeout)
+			timeout = connection_timeout;
+	}
+	
+	if(timeout < 0.1)
+		timeout = 0.1;
+	
+	return timeout;
+}
+
+
+
+void wr_client_keepalive(void) {
+	wr_connection_t			*connection, *current;
+	wi_time_interval_t		interval;
+	wi_uinteger_t			i, count;
+	
+	current		= wr_connection;
+	interval	= wi_time_interval();
+	count		= wi_array_count(wr_connections);
+	
+	for(i = 0; i < count; i++) {
+		connection = WI_ARRAY(wr_connections, i);
+		wr_connection = connection;
+		
+		wr_client_connection_keepalive(connection, interval);
+	}
+	
+	wr_connection = current;
+}
+
+
+
+void wr_client_ping_reply(wi_p7_message_t *message) {
+	wr_connection_t			*connection = wr_connection;
+	wi_time_interval_t		rtt, maximum;
+	wi_uinteger_t			i;
+	
+	if(connection->ping_time <= 0.0)
+		return;
+	
+	rtt = wi_time_interval() - connection->ping_time;
+	connection->ping_time = 0.0;
+	
+	for(i = 0; i < WR_CONNECTION_RTT_BUCKETS - 1; i++) {
+		if(rtt <= wr_client_rtt_buckets[i])
+			break;
+	}
+	
+	connection->rtt_histogram[i]++;
+	
+	maximum = wi_config_integer_for_name(wd_config, WI_STR("ping interval"));
+	
+	if(connection->rtt_count == 0) {
+		connection->srtt	= rtt;
+		connection->rttvar	= rtt / 2.0;
+		connection->rtt_min	= rtt;
+		connection->rtt_max	= rtt;
 	} else {
-		wr_client_disconnect();
+		// a reply well outside the usual variation means the link is
+		// degrading, so probe it more often until it settles again
+		if(rtt > connection->srtt + (2.0 * connection->rttvar))
+			connection->ping_interval /= 2.0;
+		else
+			connection->ping_interval *= 1.25;
+		
+		connection->rttvar	= (0.75 * connection->rttvar) + (0.25 * fabs(connection->srtt - rtt));
+		connection->srtt	= (0.875 * connection->srtt) + (0.125 * rtt);
+		
+		if(rtt < connection->rtt_min)
+			connection->rtt_min = rtt;
+		
+		if(rtt > connection->rtt_max)
+			connection->rtt_max = rtt;
+	}
+	
+	if(connection->ping_interval < WR_CLIENT_MIN_PING_INTERVAL)
+		connection->ping_interval = WR_CLIENT_MIN_PING_INTERVAL;
+	else if(connection->ping_interval > maximum)
+		connection->ping_interval = WI_MAX(maximum, WR_CLIENT_MIN_PING_INTERVAL);
+	
+	connection->rtt_count++;
+	
+	wi_log_debug(WI_STR("Ping reply from %@ after %.1f ms (srtt %.1f ms, next ping in %.0f seconds)"),
+		connection->name, rtt * 1000.0, connection->srtt * 1000.0, connection->ping_interval);
+}
 
-		if(!wr_reconnecting)
-			wr_client_reconnect();
 
-		return false;
+
+void wr_client_log_statistics(void) {
+	wr_connection_t			*connection;
+	wi_mutable_string_t		*string;
+	wi_uinteger_t			i, j, count;
+	
+	count = wi_array_count(wr_connections);
+	
+	for(i = 0; i < count; i++) {
+		connection = WI_ARRAY(wr_connections, i);
+		
+		wi_log_info(WI_STR("%@: %@, %u connects, ready in %.3f seconds, up %.0f seconds, %u messages received, %u sent, %.3f seconds in dispatch"),
+			connection->name,
+			connection->connected ? WI_STR("connected") : WI_STR("disconnected"),
+			connection->connects,
+			connection->ready_time,
+			connection->connected ? wi_time_interval() - connection->connect_time : 0.0,
+			connection->messages_received,
+			connection->messages_sent,
+			connection->dispatch_time);
+		
+		wi_log_info(WI_STR("%@: round trip: %u samples, min %.1f ms, avg %.1f ms, max %.1f ms, var %.1f ms"),
+			connection->name,
+			connection->rtt_count,
+			connection->rtt_min * 1000.0,
+			connection->srtt * 1000.0,
+			connection->rtt_max * 1000.0,
+			connection->rttvar * 1000.0);
+		
+		string = wi_mutable_string();
+		
+		for(j = 0; j < WR_CONNECTION_RTT_BUCKETS - 1; j++) {
+			wi_mutable_string_append_format(string, WI_STR("<=%.0fms: %u, "),
+				wr_client_rtt_buckets[j] * 1000.0, connection->rtt_histogram[j]);
+		}
+		
+		wi_mutable_string_append_format(string, WI_STR(">%.0fms: %u"),
+			wr_client_rtt_buckets[j - 1] * 1000.0, connection->rtt_histogram[j]);
+		
+		wi_log_info(WI_STR("%@: round trip histogram: %@"), connection->name, string);
+		
+		if(wr_client_instrument_transport) {
+			wi_log_info(WI_STR("%@: transport %@: %u reads at %.1f us CPU, %.1f us verifying, %u writes at %.1f us CPU, compression ratio %.2f"),
+				connection->name,
+				wr_client_transport_description(connection->transport_options),
+				connection->transport_reads,
+				connection->transport_reads > 0 ? connection->read_cpu_time * 1000000.0 / connection->transport_reads : 0.0,
+				connection->transport_reads > 0 ? connection->verify_cpu_time * 1000000.0 / connection->transport_reads : 0.0,
+				connection->transport_writes,
+				connection->transport_writes > 0 ? connection->write_cpu_time * 1000000.0 / connection->transport_writes : 0.0,
+				connection->p7_socket ? wi_p7_socket_compression_ratio(connection->p7_socket) : 0.0);
+		}
 	}
 }
 
@@ -527,6 +1230,9 @@ void wr_client_apply_settings(wi_set_t *changes) {
 	wi_string_t 		*command;
 	wi_p7_message_t		*message;
 
+	if(wi_set_contains_data(changes, WI_STR("transport instrumentation")))
+		wr_client_instrument_transport = wi_config_bool_for_name(wd_config, WI_STR("transport instrumentation"));
+
 	if(wi_set_contains_data(changes, WI_STR("nick"))) {
 		wi_release(wr_nick);
 
@@ -535,11 +1241,9 @@ void wr_client_apply_settings(wi_set_t *changes) {
 		if(!wr_nick)
 			wr_nick = wi_retain(wi_user_name());
 
-		if(wr_connected) {
-			message = wi_p7_message_with_name(WI_STR("wired.user.set_nick"), wr_p7_spec);
-			wi_p7_message_set_string_for_name(message, wr_nick, WI_STR("wired.user.nick"));
-			wr_client_send_message(message);
-		}
+		message = wi_p7_message_with_name(WI_STR("wired.user.set_nick"), wr_p7_spec);
+		wi_p7_message_set_string_for_name(message, wr_nick, WI_STR("wired.user.nick"));
+		wr_client_broadcast_message(message);
 	}
 
 	if(wi_set_contains_data(changes, WI_STR("status"))) {
@@ -547,11 +1251,9 @@ void wr_client_apply_settings(wi_set_t *changes) {
 
 		wr_status 	= wi_retain(wi_config_string_for_name(wd_config, WI_STR("status")));
 
-		if(wr_connected) {
-			message = wi_p7_message_with_name(WI_STR("wired.user.set_status"), wr_p7_spec);
-			wi_p7_message_set_string_for_name(message, wr_status, WI_STR("wired.user.status"));
-			wr_client_send_message(message);
-		}
+		message = wi_p7_message_with_name(WI_STR("wired.user.set_status"), wr_p7_spec);
+		wi_p7_message_set_string_for_name(message, wr_status, WI_STR("wired.user.status"));
+		wr_client_broadcast_message(message);
 	}
 
 	if(wi_set_contains_data(changes, WI_STR("icon"))) {
@@ -566,11 +1268,9 @@ void wr_client_apply_settings(wi_set_t *changes) {
 		// 	if(!wr_icon)
 		// 		wr_icon = wi_data_init_with_base64(wi_data_alloc(), wi_string_with_cstring(wr_default_icon));
 
-			if(wr_connected) {
-				message = wi_p7_message_with_name(WI_STR("wired.user.set_icon"), wr_p7_spec);
-				wi_p7_message_set_data_for_name(message, wr_icon, WI_STR("wired.user.icon"));
-				wr_client_send_message(message);
-			}
+			message = wi_p7_message_with_name(WI_STR("wired.user.set_icon"), wr_p7_spec);
+			wi_p7_message_set_data_for_name(message, wr_icon, WI_STR("wired.user.icon"));
+			wr_client_broadcast_message(message);
 		//}
 	}
 }
@@ -29,22 +29,38 @@
 #ifndef WR_CLIENT_H
 #define WR_CLIENT_H 1
 
+#include "connection.h"
 #include "server.h"
 
 #define WR_PORT							4871
 #define WR_CHECKSUM_SIZE				1048576
 
+#define WR_CLIENT_MIN_PING_INTERVAL		5.0
+#define WR_CLIENT_MIN_PING_TIMEOUT		2.0
+
 void									wr_client_init(void);
 
 wi_boolean_t							wr_client_set_charset(wi_string_t *);
 
-void									wr_client_connect(wi_string_t *, wi_uinteger_t, wi_string_t *, wi_string_t *);
-void									wr_client_reconnect(void);
-void									wr_client_disconnect(void);
+wi_boolean_t							wr_client_connect(wr_connection_t *);
+void									wr_client_connect_all(void);
+void									wr_client_reconnect(wr_connection_t *);
+void									wr_client_disconnect(wr_connection_t *);
+void									wr_client_disconnect_all(void);
+
+wi_p7_uint32_t							wr_client_next_transaction(void);
 
 void									wr_client_send_message(wi_p7_message_t *);
+void									wr_client_send_message_on_connection(wr_connection_t *, wi_p7_message_t *);
+wi_boolean_t							wr_client_verify_message(wr_connection_t *, wi_p7_message_t *);
+void									wr_client_broadcast_message(wi_p7_message_t *);
 void									wr_client_reply_message(wi_p7_message_t *, wi_p7_message_t *);
 
+wi_time_interval_t						wr_client_keepalive_timeout(void);
+void									wr_client_keepalive(void);
+void									wr_client_ping_reply(wi_p7_message_t *);
+void									wr_client_log_statistics(void);
+
 void									wr_client_apply_settings(wi_set_t *);
 void 									wr_client_reload_icon(void);
 
@@ -57,14 +73,6 @@ extern wi_data_t						*wr_icon;
 extern wi_string_t						*wr_icon_path;
 extern wi_string_t						*wr_timestamp_format;
 
-extern wr_server_t						*wr_server;
-
-extern wi_socket_t						*wr_socket;
-extern wi_p7_socket_t					*wr_p7_socket;
-
-extern wi_string_t						*wr_password;
-
-extern wi_boolean_t						wr_connected;
-extern wi_p7_uint32_t					wb_user_id;
+extern wi_boolean_t						wr_client_instrument_transport;
 
 #endif /* WR_CLIENT_H */
@@ -274,7 +274,9 @@ static wr_commands_t			wr_commands[] = {
 
 
 static wi_mutable_dictionary_t			*wr_commands_transactions;
-static wi_p7_uint32_t					wr_commands_transaction;
+
+// chat that say and me go to, the bot points it at the chat it replies to
+wr_cid_t								wr_commands_chat_id = WR_PUBLIC_CID;
 
 
 void wr_commands_initialize(void) {
@@ -301,7 +303,7 @@ void wr_commands_parse_command(wi_string_t *buffer, wi_boolean_t chat) {
 	wi_uinteger_t	index;	
 	
 	if(chat && !wi_string_has_prefix(buffer, WI_STR("/")))
-		buffer = wi_string_by_inserting_string_at_index(buffer, wr_connected ? WI_STR("say ") : WI_STR("echo "), 0);
+		buffer = wi_string_by_inserting_string_at_index(buffer, wr_connection->connected ? WI_STR("say ") : WI_STR("echo "), 0);
 	
 	wr_commands_split_command(buffer, &command, &arguments);
 	
@@ -312,7 +314,7 @@ void wr_commands_parse_command(wi_string_t *buffer, wi_boolean_t chat) {
 		return;
 	}
 	
-	if(wr_commands[index].connected && !wr_connected) {
+	if(wr_commands[index].connected && !wr_connection->connected) {
 		wi_log_error(WI_STR("%@: %@"), command, WI_STR("Not connected"));
 
 		return;
@@ -388,19 +390,32 @@ static void wr_commands_split_command(wi_string_t *buffer, wi_string_t **out_com
 
 
 static void wr_commands_send_message(wi_p7_message_t *message, wi_string_t *command) {
-	wi_p7_message_set_uint32_for_name(message, wr_commands_transaction, WI_STR("wired.transaction"));
+	wi_p7_uint32_t		transaction;
 	
-	wi_mutable_dictionary_set_data_for_key(wr_commands_transactions, command, WI_INT32(wr_commands_transaction));
+	transaction = wr_client_next_transaction();
 	
-	wr_client_send_message(message);
+	wi_p7_message_set_uint32_for_name(message, transaction, WI_STR("wired.transaction"));
 	
-	wr_commands_transaction++;
+	wi_mutable_dictionary_set_data_for_key(wr_commands_transactions, command, WI_INT32(transaction));
+	
+	wr_client_send_message(message);
 }
 
 
 
 #pragma mark -
 
+void wr_commands_send_private_message(wr_uid_t uid, wi_string_t *string) {
+	wi_p7_message_t		*message;
+	
+	message = wi_p7_message_with_name(WI_STR("wired.message.send_message"), wr_p7_spec);
+	wi_p7_message_set_uint32_for_name(message, uid, WI_STR("wired.user.id"));
+	wi_p7_message_set_string_for_name(message, string, WI_STR("wired.message.message"));
+	wr_commands_send_message(message, WI_STR("msg"));
+}
+
+
+
 wi_string_t * wr_commands_command_for_message(wi_p7_message_t *message) {
 	wi_p7_uint32_t		transaction;
 	
@@ -522,8 +537,8 @@ static void wr_command_close(wi_array_t *arguments) {
 	wi_p7_message_t		*message;
 	
 	if(wr_window_is_public_chat(wr_current_window)) {
-		if(wr_connected)
-			wr_client_disconnect();
+		if(wr_connection->connected)
+			wr_client_disconnect(wr_connection);
 		else
 			wr_printf_prefix(WI_STR("close: %@"), WI_STR("Not connected"));
 	} else {
@@ -544,7 +559,7 @@ static void wr_command_close(wi_array_t *arguments) {
 */
 
 static void wr_command_disconnect(wi_array_t *arguments) {
-	wr_client_disconnect();
+	wr_client_disconnect(wr_connection);
 }
 
 
@@ -631,7 +646,7 @@ static void wr_command_icon(wi_array_t *arguments) {
 		wi_release(wr_icon);
 		wr_icon = wi_retain(data);
 		
-		if(wr_connected) {
+		if(wr_connection->connected) {
 			message = wi_p7_message_with_name(WI_STR("wired.user.set_icon"), wr_p7_spec);
 			wi_p7_message_set_data_for_name(message, wr_icon, WI_STR("wired.user.icon"));
 			wr_commands_send_message(message, WI_STR("icon"));
@@ -697,7 +712,7 @@ static void wr_command_info(wi_array_t *arguments) {
 	enumerator = wi_array_data_enumerator(arguments);
 	
 	while((nick = wi_enumerator_next_data(enumerator))) {
-		user = wr_chat_user_with_nick(wr_public_chat, nick);
+		user = wr_chat_user_with_nick(wr_connection->public_chat, nick);
 
 		if(!user) {
 			wr_printf_prefix(WI_STR("info: %@: Client not found"),
@@ -735,7 +750,7 @@ static void wr_command_invite(wi_array_t *arguments) {
 	enumerator		= wi_array_data_enumerator(arguments);
 	
 	while((nick = wi_enumerator_next_data(enumerator))) {
-		user = wr_chat_user_with_nick(wr_public_chat, nick);
+		user = wr_chat_user_with_nick(wr_connection->public_chat, nick);
 
 		if(!user) {
 			wr_printf_prefix(WI_STR("invite: %@: Client not found"),
@@ -812,7 +827,7 @@ static void wr_command_me(wi_array_t *arguments) {
 	
 	//if(wr_window_is_chat(wr_current_window)) {
 		message = wi_p7_message_with_name(WI_STR("wired.chat.send_me"), wr_p7_spec);
-		wi_p7_message_set_uint32_for_name(message, 1, WI_STR("wired.chat.id"));
+		wi_p7_message_set_uint32_for_name(message, wr_commands_chat_id, WI_STR("wired.chat.id"));
 		wi_p7_message_set_string_for_name(message, chat, WI_STR("wired.chat.me"));
 		wr_commands_send_message(message, WI_STR("me"));
 	//}
@@ -825,13 +840,12 @@ static void wr_command_me(wi_array_t *arguments) {
 */
 
 static void wr_command_msg(wi_array_t *arguments) {
-	wi_p7_message_t		*message;
 	wi_string_t			*nick;
 	wr_user_t			*user;
 	wr_window_t			*window;
 
 	nick = WI_ARRAY(arguments, 0);
-	user = wr_chat_user_with_nick(wr_public_chat, nick);
+	user = wr_chat_user_with_nick(wr_connection->public_chat, nick);
 
 	if(!user) {
 		wr_printf_prefix(WI_STR("msg: %@: Client not found"),
@@ -840,10 +854,7 @@ static void wr_command_msg(wi_array_t *arguments) {
 		return;
 	}
 	
-	message = wi_p7_message_with_name(WI_STR("wired.message.send_message"), wr_p7_spec);
-	wi_p7_message_set_uint32_for_name(message, wr_user_id(user), WI_STR("wired.user.id"));
-	wi_p7_message_set_string_for_name(message, WI_ARRAY(arguments, 1), WI_STR("wired.message.message"));
-	wr_commands_send_message(message, WI_STR("msg"));
+	wr_commands_send_private_message(wr_user_id(user), WI_ARRAY(arguments, 1));
 	
 	// window = wr_windows_window_with_user(user);
 	
@@ -873,7 +884,7 @@ static void wr_command_nick(wi_array_t *arguments) {
 		wi_release(wr_nick);
 		wr_nick = wi_retain(nick);
 				
-		if(wr_connected) {
+		if(wr_connection->connected) {
 			message = wi_p7_message_with_name(WI_STR("wired.user.set_nick"), wr_p7_spec);
 			wi_p7_message_set_string_for_name(message, nick, WI_STR("wired.user.nick"));
 			wr_commands_send_message(message, WI_STR("nick"));
@@ -952,7 +963,8 @@ static void wr_command_open(wi_array_t *arguments) {
 		return;
 	}
 	
-	wr_client_connect(host, port, login, password);
+	wr_connection_set_address(wr_connection, host, port, login, password);
+	wr_client_connect(wr_connection);
 }
 
 
@@ -968,7 +980,7 @@ static void wr_command_privchat(wi_array_t *arguments) {
 	
 	if(wi_array_count(arguments) > 0) {
 		nick = WI_ARRAY(arguments, 0);
-		user = wr_chat_user_with_nick(wr_public_chat, nick);
+		user = wr_chat_user_with_nick(wr_connection->public_chat, nick);
 		
 		if(!user) {
 			wr_printf_prefix(WI_STR("privchat: %@: Client not found"),
@@ -1027,24 +1039,24 @@ static void wr_command_save(wi_array_t *arguments) {
 	if(wr_icon_path)
 		wi_file_write_format(file, WI_STR("icon %@\n"), wr_icon_path);
 	
-	if(wr_connected) {
-		if(wi_string_length(wi_p7_socket_user_name(wr_p7_socket)) > 0)
-			login = wi_string_with_format(WI_STR("-l %@"), wi_p7_socket_user_name(wr_p7_socket));
+	if(wr_connection->connected) {
+		if(wi_string_length(wi_p7_socket_user_name(wr_connection->p7_socket)) > 0)
+			login = wi_string_with_format(WI_STR("-l %@"), wi_p7_socket_user_name(wr_connection->p7_socket));
 		else
 			login = NULL;
 		
-		if(wi_string_length(wr_password) > 0)
-			password = wi_string_with_format(WI_STR("-p %@"), wr_password);
+		if(wi_string_length(wr_connection->password) > 0)
+			password = wi_string_with_format(WI_STR("-p %@"), wr_connection->password);
 		else
 			password = NULL;
 		
-		if(wi_address_port(wi_socket_address(wr_socket)) != WR_PORT)
-			port = wi_string_with_format(WI_STR("-P %u"), wi_address_port(wi_socket_address(wr_socket)));
+		if(wi_address_port(wi_socket_address(wr_connection->socket)) != WR_PORT)
+			port = wi_string_with_format(WI_STR("-P %u"), wi_address_port(wi_socket_address(wr_connection->socket)));
 		else
 			port = NULL;
 		
 		wi_file_write_format(file, WI_STR("open %#@ %#@ %#@ %@\n"),
-			login, password, port, wi_address_string(wi_socket_address(wr_socket)));
+			login, password, port, wi_address_string(wi_socket_address(wr_connection->socket)));
 	}
 	
 	wr_printf_prefix(WI_STR("save: \"%@\" saved"), path);
@@ -1063,7 +1075,7 @@ static void wr_command_say(wi_array_t *arguments) {
 	chat = WI_ARRAY(arguments, 0);
 
 	message = wi_p7_message_with_name(WI_STR("wired.chat.send_say"), wr_p7_spec);
-	wi_p7_message_set_uint32_for_name(message, 1, WI_STR("wired.chat.id"));
+	wi_p7_message_set_uint32_for_name(message, wr_commands_chat_id, WI_STR("wired.chat.id"));
 	wi_p7_message_set_string_for_name(message, chat, WI_STR("wired.chat.say"));
 	wr_commands_send_message(message, WI_STR("say"));
 	
@@ -1094,35 +1106,45 @@ static void wr_command_serverinfo(wi_array_t *arguments) {
 
 	wr_printf_prefix(WI_STR("Server info:"));
 
-	wr_printf_block(WI_STR("Name:         %@"), wr_server_name(wr_server));
-	wr_printf_block(WI_STR("Description:  %@"), wr_server_description(wr_server));
+	wr_printf_block(WI_STR("Name:         %@"), wr_server_name(wr_connection->server));
+	wr_printf_block(WI_STR("Description:  %@"), wr_server_description(wr_connection->server));
 
-	interval	= wi_time_interval_string(wi_date_time_interval_since_now(wr_server_start_time(wr_server)));
-	string		= wi_date_string_with_format(wr_server_start_time(wr_server), WI_STR("%a %b %e %T %Y"));
+	interval	= wi_time_interval_string(wi_date_time_interval_since_now(wr_server_start_time(wr_connection->server)));
+	string		= wi_date_string_with_format(wr_server_start_time(wr_connection->server), WI_STR("%a %b %e %T %Y"));
 
 	wr_printf_block(WI_STR("Uptime:       %@, since %@"), interval, string);
 
 	wr_printf_block(WI_STR("Files:        %u %@"),
-		wr_server_files_count(wr_server),
-		wr_server_files_count(wr_server) == 1
+		wr_server_files_count(wr_connection->server),
+		wr_server_files_count(wr_connection->server) == 1
 			? WI_STR("file")
 			: WI_STR("files"));
-	wr_printf_block(WI_STR("Size:         %@"), wr_string_for_bytes(wr_server_files_size(wr_server)));
+	wr_printf_block(WI_STR("Size:         %@"), wr_string_for_bytes(wr_server_files_size(wr_connection->server)));
 	wr_printf_block(WI_STR("Version:      %@ %@ (%u) on %@ %@ (%@)"),
-		wr_server_application_name(wr_server),
-		wr_server_application_version(wr_server),
-		wr_server_application_build(wr_server),
-		wr_server_os_name(wr_server),
-		wr_server_os_version(wr_server),
-		wr_server_arch(wr_server));
+		wr_server_application_name(wr_connection->server),
+		wr_server_application_version(wr_connection->server),
+		wr_server_application_build(wr_connection->server),
+		wr_server_os_name(wr_connection->server),
+		wr_server_os_version(wr_connection->server),
+		wr_server_arch(wr_connection->server));
 	wr_printf_block(WI_STR("Protocol:     %@ %@"),
-		wi_p7_socket_remote_protocol_name(wr_p7_socket),
-		wi_p7_socket_remote_protocol_version(wr_p7_socket));
-	wr_printf_block(WI_STR("Cipher:       %@/%u bits"),
-		wi_cipher_name(wi_p7_socket_cipher(wr_p7_socket)),
-		wi_cipher_bits(wi_p7_socket_cipher(wr_p7_socket)));
-	wr_printf_block(WI_STR("Compression:  Yes, compression ratio %.2f"),
-		wi_p7_socket_compression_ratio(wr_p7_socket));
+		wi_p7_socket_remote_protocol_name(wr_connection->p7_socket),
+		wi_p7_socket_remote_protocol_version(wr_connection->p7_socket));
+	
+	if(wi_p7_socket_cipher(wr_connection->p7_socket)) {
+		wr_printf_block(WI_STR("Cipher:       %@/%u bits"),
+			wi_cipher_name(wi_p7_socket_cipher(wr_connection->p7_socket)),
+			wi_cipher_bits(wi_p7_socket_cipher(wr_connection->p7_socket)));
+	} else {
+		wr_printf_block(WI_STR("Cipher:       None"));
+	}
+	
+	if(wr_connection->transport_options & WI_P7_COMPRESSION_DEFLATE) {
+		wr_printf_block(WI_STR("Compression:  Yes, compression ratio %.2f"),
+			wi_p7_socket_compression_ratio(wr_connection->p7_socket));
+	} else {
+		wr_printf_block(WI_STR("Compression:  No"));
+	}
 }
 
 
@@ -1144,7 +1166,7 @@ static void wr_command_status(wi_array_t *arguments) {
 		wi_release(wr_status);
 		wr_status = wi_retain(status);
 		
-		if(wr_connected) {
+		if(wr_connection->connected) {
 			message = wi_p7_message_with_name(WI_STR("wired.user.set_status"), wr_p7_spec);
 			wi_p7_message_set_string_for_name(message, status, WI_STR("wired.user.status"));
 			wr_commands_send_message(message, WI_STR("status"));
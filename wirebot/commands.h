@@ -29,12 +29,14 @@
 #ifndef WR_COMMANDS_H
 #define WR_COMMANDS_H 1
 
+#include "chats.h"
 #include "main.h"
 
 void							wr_commands_initialize(void);
 
 void							wr_commands_parse_file(wi_file_t *);
 void							wr_commands_parse_command(wi_string_t *, wi_boolean_t);
+void							wr_commands_send_private_message(wr_uid_t, wi_string_t *);
 
 wi_string_t *					wr_commands_command_for_message(wi_p7_message_t *);
 wr_completer_t					wr_commands_completer_for_command(wi_string_t *);
@@ -43,5 +45,6 @@ char *							wr_readline_command_generator(const char *, int);
 
 
 extern wi_string_t				*wr_last_command;
+extern wr_cid_t					wr_commands_chat_id;
 
 #endif /* WR_COMMANDS_H */
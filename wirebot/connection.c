@@ -0,0 +1,242 @@
+/* $Id$ */
+
+/*
+ *  Copyright (c) 2012 Rafael Warnault
+ *  All rights reserved.
+ * 
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "config.h"
+
+#include <wired/wired.h>
+
+#include "client.h"
+#include "connection.h"
+#include "settings.h"
+
+static void							wr_connection_dealloc(wi_runtime_instance_t *);
+static wi_string_t *				wr_connection_description(wi_runtime_instance_t *);
+
+
+wi_mutable_array_t					*wr_connections;
+wr_connection_t						*wr_connection;
+
+static wi_runtime_id_t				wr_connection_runtime_id = WI_RUNTIME_ID_NULL;
+static wi_runtime_class_t			wr_connection_runtime_class = {
+	"wr_connection_t",
+	wr_connection_dealloc,
+	NULL,
+	NULL,
+	wr_connection_description,
+	NULL
+};
+
+
+void wr_connections_init(void) {
+	wr_connection_runtime_id = wi_runtime_register_class(&wr_connection_runtime_class);
+	
+	wr_connections = wi_array_init(wi_mutable_array_alloc());
+}
+
+
+
+void wr_connections_load_config(void) {
+	wi_enumerator_t		*enumerator;
+	wi_array_t			*servers;
+	wi_string_t			*string;
+	wi_url_t			*url;
+	wr_connection_t		*connection;
+	
+	servers = wi_config_stringlist_for_name(wd_config, WI_STR("server"));
+	
+	if(servers) {
+		enumerator = wi_array_data_enumerator(servers);
+		
+		while((string = wi_enumerator_next_data(enumerator))) {
+			url = wi_autorelease(wi_url_init_with_string(wi_url_alloc(), string));
+			
+			if(!url || wi_string_length(wi_url_host(url)) == 0) {
+				wi_log_warn(WI_STR("Could not parse server \"%@\", ignoring"), string);
+				
+				continue;
+			}
+			
+			connection = wr_connection_init_with_url(wr_connection_alloc(), url);
+			wi_mutable_array_add_data(wr_connections, connection);
+			wi_release(connection);
+		}
+	}
+	
+	// a single server configured the old way
+	if(wi_array_count(wr_connections) == 0) {
+		connection = wr_connection_init_with_address(wr_connection_alloc(),
+			wi_config_string_for_name(wd_config, WI_STR("hostname")),
+			wi_config_port_for_name(wd_config, WI_STR("port")),
+			wi_config_string_for_name(wd_config, WI_STR("login")),
+			wi_config_string_for_name(wd_config, WI_STR("password")));
+		wi_mutable_array_add_data(wr_connections, connection);
+		wi_release(connection);
+	}
+	
+	wr_connection = wr_connections_first();
+}
+
+
+
+#pragma mark -
+
+wr_connection_t * wr_connections_first(void) {
+	if(wi_array_count(wr_connections) == 0)
+		return NULL;
+	
+	return WI_ARRAY(wr_connections, 0);
+}
+
+
+
+wr_connection_t * wr_connections_connection_with_socket(wi_socket_t *socket) {
+	wr_connection_t		*connection;
+	wi_uinteger_t		i, count;
+	
+	count = wi_array_count(wr_connections);
+	
+	for(i = 0; i < count; i++) {
+		connection = WI_ARRAY(wr_connections, i);
+		
+		if(connection->socket == socket)
+			return connection;
+	}
+	
+	return NULL;
+}
+
+
+
+#pragma mark -
+
+wr_connection_t * wr_connection_alloc(void) {
+	return wi_runtime_create_instance(wr_connection_runtime_id, sizeof(wr_connection_t));
+}
+
+
+
+wr_connection_t * wr_connection_init_with_url(wr_connection_t *connection, wi_url_t *url) {
+	return wr_connection_init_with_address(connection,
+		wi_url_host(url),
+		wi_url_port(url),
+		wi_url_user(url),
+		wi_url_password(url));
+}
+
+
+
+wr_connection_t * wr_connection_init_with_address(wr_connection_t *connection, wi_string_t *hostname, wi_uinteger_t port, wi_string_t *login, wi_string_t *password) {
+	connection->chats			= wr_intmap_create(0);
+	connection->users			= wr_intmap_create(0);
+	connection->public_chat		= wr_chat_init_public_chat(wr_chat_alloc());
+	
+	wr_connection_clear_chats(connection);
+	wr_connection_set_address(connection, hostname, port, login, password);
+	
+	return connection;
+}
+
+
+
+static void wr_connection_dealloc(wi_runtime_instance_t *instance) {
+	wr_connection_t		*connection = instance;
+	
+	wi_release(connection->name);
+	wi_release(connection->hostname);
+	wi_release(connection->login);
+	wi_release(connection->password);
+	
+	wi_release(connection->socket);
+	wi_release(connection->p7_socket);
+	wi_release(connection->server);
+	
+	wi_release(connection->connect_attempt);
+	wi_release(connection->connect_messages);
+	wi_release(connection->connect_socket);
+	wi_release(connection->connect_p7_socket);
+	wi_release(connection->connect_server);
+	
+	wr_intmap_destroy(connection->chats);
+	wr_intmap_destroy(connection->users);
+	wi_release(connection->public_chat);
+}
+
+
+
+static wi_string_t * wr_connection_description(wi_runtime_instance_t *instance) {
+	wr_connection_t		*connection = instance;
+	
+	return wi_string_with_format(WI_STR("<%@ %p>{name = %@, connected = %d}"),
+		wi_runtime_class_name(connection),
+		connection,
+		connection->name,
+		connection->connected);
+}
+
+
+
+#pragma mark -
+
+void wr_connection_set_address(wr_connection_t *connection, wi_string_t *hostname, wi_uinteger_t port, wi_string_t *login, wi_string_t *password) {
+	if(port == 0)
+		port = WR_PORT;
+	
+	if(wi_string_length(login) == 0)
+		login = WI_STR("guest");
+	
+	if(!password)
+		password = WI_STR("");
+	
+	wi_retain(hostname);
+	wi_release(connection->hostname);
+	connection->hostname	= hostname;
+	
+	wi_retain(login);
+	wi_release(connection->login);
+	connection->login		= login;
+	
+	wi_retain(password);
+	wi_release(connection->password);
+	connection->password	= password;
+	
+	connection->port		= port;
+	
+	wi_release(connection->name);
+	connection->name		= wi_string_init_with_format(wi_string_alloc(), WI_STR("%@@%@:%u"), login, hostname, port);
+}
+
+
+
+void wr_connection_clear_chats(wr_connection_t *connection) {
+	wr_intmap_remove_all_data(connection->chats);
+	wr_intmap_remove_all_data(connection->users);
+	wr_chat_remove_all_users(connection->public_chat);
+	wr_intmap_set_data_for_key(connection->chats, connection->public_chat, wr_chat_id(connection->public_chat));
+	
+	wr_private_chat_invite_uid = 0;
+}
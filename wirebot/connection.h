@@ -0,0 +1,114 @@
+/* $Id$ */
+
+/*
+ *  Copyright (c) 2012 Rafael Warnault
+ *  All rights reserved.
+ * 
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef WR_CONNECTION_H
+#define WR_CONNECTION_H 1
+
+#include "chats.h"
+#include "intmap.h"
+#include "server.h"
+
+#define WR_CONNECTION_RTT_BUCKETS		12
+#define WR_CONNECTION_RECONNECT_DELAY	10.0
+
+
+struct _wr_connection {
+	wi_runtime_base_t				base;
+	
+	wi_string_t						*name;
+	wi_string_t						*hostname;
+	wi_uinteger_t					port;
+	wi_string_t						*login;
+	wi_string_t						*password;
+	
+	wi_socket_t						*socket;
+	wi_p7_socket_t					*p7_socket;
+	wr_server_t						*server;
+	
+	wi_boolean_t					connected;
+	wi_boolean_t					reconnecting;
+	wi_time_interval_t				reconnect_time;
+	
+	struct _wr_connection			*connect_attempt;
+	wi_boolean_t					connect_done;
+	wi_array_t						*connect_messages;
+	wi_socket_t						*connect_socket;
+	wi_p7_socket_t					*connect_p7_socket;
+	wr_server_t						*connect_server;
+	wi_p7_options_t					connect_options;
+	wi_p7_uint32_t					user_id;
+	
+	wr_intmap_t						*chats;
+	wr_intmap_t						*users;
+	wr_chat_t						*public_chat;
+	
+	wi_time_interval_t				last_read_time;
+	wi_time_interval_t				ping_time;
+	wi_time_interval_t				ping_interval;
+	wi_time_interval_t				srtt;
+	wi_time_interval_t				rttvar;
+	wi_time_interval_t				rtt_min;
+	wi_time_interval_t				rtt_max;
+	wi_uinteger_t					rtt_count;
+	wi_uinteger_t					rtt_histogram[WR_CONNECTION_RTT_BUCKETS];
+	
+	wi_p7_options_t					transport_options;
+	wi_uinteger_t					transport_reads;
+	wi_uinteger_t					transport_writes;
+	wi_time_interval_t				read_cpu_time;
+	wi_time_interval_t				verify_cpu_time;
+	wi_time_interval_t				write_cpu_time;
+	
+	wi_time_interval_t				connect_time;
+	wi_time_interval_t				ready_time;
+	wi_uinteger_t					connects;
+	wi_uinteger_t					messages_received;
+	wi_uinteger_t					messages_sent;
+	wi_time_interval_t				dispatch_time;
+};
+typedef struct _wr_connection		wr_connection_t;
+
+
+void								wr_connections_init(void);
+void								wr_connections_load_config(void);
+
+wr_connection_t *					wr_connections_first(void);
+wr_connection_t *					wr_connections_connection_with_socket(wi_socket_t *);
+
+wr_connection_t *					wr_connection_alloc(void);
+wr_connection_t *					wr_connection_init_with_url(wr_connection_t *, wi_url_t *);
+wr_connection_t *					wr_connection_init_with_address(wr_connection_t *, wi_string_t *, wi_uinteger_t, wi_string_t *, wi_string_t *);
+
+void								wr_connection_set_address(wr_connection_t *, wi_string_t *, wi_uinteger_t, wi_string_t *, wi_string_t *);
+void								wr_connection_clear_chats(wr_connection_t *);
+
+
+extern wi_mutable_array_t			*wr_connections;
+extern wr_connection_t				*wr_connection;
+
+#endif /* WR_CONNECTION_H */
@@ -142,7 +142,7 @@ char * wr_readline_filename_generator(const char *text, int state) {
         
 		wr_files_clear();
 		// wr_send_command(WI_STR("LIST %@"), full_path);
-		wr_runloop_run_for_socket(wr_socket, 3.0, 411);
+		wr_runloop_run_for_socket(wr_connection->socket, 3.0, 411);
 	}
     
 	if(wi_string_has_suffix(path, WI_STR("/")))
@@ -317,7 +317,7 @@ static void * wr_files_glob_opendir(const char *path) {
 	wr_ls_state = WR_LS_GLOBBING;
 	wr_files_clear();
 	// wr_send_command(WI_STR("LIST %@"), dir->path);
-	wr_runloop_run_for_socket(wr_socket, 3.0, 411);
+	wr_runloop_run_for_socket(wr_connection->socket, 3.0, 411);
 	
 	dir->count = wi_array_count(wr_files);
 	dir->entries = wi_malloc(sizeof(struct dirent *) * (dir->count + 1));
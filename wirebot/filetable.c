@@ -0,0 +1,368 @@
+/* $Id$ */
+
+/*
+ *  Copyright (c) 2012 Rafael Warnault
+ *  All rights reserved.
+ * 
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "config.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <wired/wired.h>
+
+#include "filetable.h"
+
+/*
+	The files of one watched directory, as fixed size records in an open
+	addressing table keyed by a 64-bit hash of the path. A record is 32
+	bytes, so a million files fit in 32 MB plus the slack of a power of two
+	table, where sets of path strings took several times that.
+	
+	Only the last component of each path is kept, packed in one buffer per
+	table and found by the offset in the record, so that removed files can
+	still be named. The buffer is rebuilt when a listing drops records.
+	
+	Listings are diffed with generations: a listing bumps the generation of
+	the table, every file it lists is stamped with it, and when it is done
+	the records left with an older generation are the files that went away.
+	No second table is built for the new listing.
+*/
+
+#define WB_FILETABLE_MIN_CAPACITY		16
+
+struct _wb_filetable {
+	wi_runtime_base_t				base;
+	
+	wb_file_record_t				*records;
+	wi_uinteger_t					capacity;
+	wi_uinteger_t					count;
+	
+	char							*names;
+	wi_uinteger_t					names_length;
+	wi_uinteger_t					names_capacity;
+	
+	uint16_t						generation;
+	wi_boolean_t					listing;
+};
+
+
+static void							wb_filetable_dealloc(wi_runtime_instance_t *);
+static wb_file_record_t *			wb_filetable_records_create(wi_uinteger_t);
+static void							wb_filetable_rehash(wb_filetable_t *, wi_uinteger_t, wi_boolean_t);
+static wb_file_record_t *			wb_filetable_slot(wb_file_record_t *, wi_uinteger_t, uint64_t);
+static uint32_t						wb_filetable_append_name(wb_filetable_t *, const char *);
+
+
+static wi_runtime_id_t				wb_filetable_runtime_id = WI_RUNTIME_ID_NULL;
+static wi_runtime_class_t			wb_filetable_runtime_class = {
+	"wb_filetable_t",
+	wb_filetable_dealloc,
+	NULL,
+	NULL,
+	NULL,
+	NULL
+};
+
+
+
+void wb_filetables_init(void) {
+	wb_filetable_runtime_id = wi_runtime_register_class(&wb_filetable_runtime_class);
+}
+
+
+
+wb_filetable_t * wb_filetable_alloc(void) {
+	return wi_runtime_create_instance(wb_filetable_runtime_id, sizeof(wb_filetable_t));
+}
+
+
+
+wb_filetable_t * wb_filetable_init(wb_filetable_t *table) {
+	table->capacity		= WB_FILETABLE_MIN_CAPACITY;
+	table->records		= wb_filetable_records_create(table->capacity);
+	table->count		= 0;
+	table->names		= NULL;
+	table->names_length	= 0;
+	table->names_capacity	= 0;
+	table->generation	= 0;
+	table->listing		= false;
+	
+	return table;
+}
+
+
+
+#pragma mark -
+
+uint64_t wb_filetable_key(wi_string_t *path) {
+	const unsigned char		*p;
+	uint64_t				key;
+	
+	// FNV-1a, with 0 kept for empty slots
+	key = 14695981039346656037ULL;
+	
+	for(p = (const unsigned char *) wi_string_cstring(path); *p; p++) {
+		key ^= *p;
+		key *= 1099511628211ULL;
+	}
+	
+	return key ? key : 1;
+}
+
+
+
+wb_file_record_t * wb_filetable_record(wb_filetable_t *table, uint64_t key) {
+	wb_file_record_t		*record;
+	
+	record = wb_filetable_slot(table->records, table->capacity, key);
+	
+	return record->key ? record : NULL;
+}
+
+
+
+wb_file_record_t * wb_filetable_add_record(wb_filetable_t *table, uint64_t key, wi_boolean_t *created) {
+	wb_file_record_t		*record;
+	
+	if((table->count + 1) * 4 > table->capacity * 3)
+		wb_filetable_rehash(table, table->capacity * 2, false);
+	
+	record = wb_filetable_slot(table->records, table->capacity, key);
+	
+	if(record->key) {
+		*created = false;
+	} else {
+		memset(record, 0, sizeof(wb_file_record_t));
+		
+		record->key		= key;
+		*created		= true;
+		
+		table->count++;
+	}
+	
+	record->generation = table->generation;
+	
+	return record;
+}
+
+
+
+void wb_filetable_set_name(wb_filetable_t *table, wb_file_record_t *record, wi_string_t *name) {
+	record->name = wb_filetable_append_name(table, wi_string_cstring(name));
+}
+
+
+
+wi_string_t * wb_filetable_name(wb_filetable_t *table, wb_file_record_t *record) {
+	if(record->name == 0)
+		return NULL;
+	
+	return wi_string_with_cstring(table->names + record->name - 1);
+}
+
+
+
+#pragma mark -
+
+void wb_filetable_begin_listing(wb_filetable_t *table) {
+	table->generation++;
+	table->listing = true;
+}
+
+
+
+wi_boolean_t wb_filetable_is_listing(wb_filetable_t *table) {
+	return table->listing;
+}
+
+
+
+uint16_t wb_filetable_generation(wb_filetable_t *table) {
+	return table->generation;
+}
+
+
+
+wi_uinteger_t wb_filetable_end_listing(wb_filetable_t *table, wi_mutable_array_t *names) {
+	wb_file_record_t	*record;
+	wi_string_t			*name;
+	wi_uinteger_t		i, removed;
+	
+	table->listing = false;
+	
+	// partial uploads come and go with every transfer, they are not
+	// counted as removed files
+	removed = 0;
+	
+	for(i = 0; i < table->capacity; i++) {
+		record = &table->records[i];
+		
+		if(record->key && record->generation != table->generation && record->state != WB_FILE_PARTIAL) {
+			name = wb_filetable_name(table, record);
+			
+			if(names && name)
+				wi_mutable_array_add_data(names, name);
+			
+			removed++;
+		}
+	}
+	
+	// rebuilding drops the records the listing did not stamp, and shrinks
+	// the table back after a directory was emptied
+	wb_filetable_rehash(table, table->capacity, true);
+	
+	return removed;
+}
+
+
+
+void wb_filetable_cancel_listing(wb_filetable_t *table) {
+	// the records the listing did not get to keep their older generation,
+	// the next listing that completes still tells whether they went away
+	table->listing = false;
+}
+
+
+
+#pragma mark -
+
+wi_uinteger_t wb_filetable_count(wb_filetable_t *table) {
+	return table->count;
+}
+
+
+
+wi_uinteger_t wb_filetable_size(wb_filetable_t *table) {
+	return table->capacity * sizeof(wb_file_record_t) + table->names_capacity;
+}
+
+
+
+#pragma mark -
+
+static void wb_filetable_dealloc(wi_runtime_instance_t *instance) {
+	wb_filetable_t		*table = instance;
+	
+	wi_free(table->records);
+	wi_free(table->names);
+}
+
+
+
+static wb_file_record_t * wb_filetable_records_create(wi_uinteger_t capacity) {
+	wb_file_record_t	*records;
+	
+	records = wi_malloc(capacity * sizeof(wb_file_record_t));
+	
+	memset(records, 0, capacity * sizeof(wb_file_record_t));
+	
+	return records;
+}
+
+
+
+static void wb_filetable_rehash(wb_filetable_t *table, wi_uinteger_t capacity, wi_boolean_t stale) {
+	wb_file_record_t	*records, *record;
+	char				*names;
+	wi_uinteger_t		i, count;
+	
+	count = 0;
+	
+	for(i = 0; i < table->capacity; i++) {
+		if(table->records[i].key && (!stale || table->records[i].generation == table->generation))
+			count++;
+	}
+	
+	// keep the table between a quarter and three quarters full
+	while(capacity > WB_FILETABLE_MIN_CAPACITY && count * 4 < capacity)
+		capacity /= 2;
+	
+	while((count + 1) * 4 > capacity * 3)
+		capacity *= 2;
+	
+	records = wb_filetable_records_create(capacity);
+	
+	// names of dropped records are left behind in the old buffer
+	names					= table->names;
+	table->names			= NULL;
+	table->names_length		= 0;
+	table->names_capacity	= 0;
+	
+	for(i = 0; i < table->capacity; i++) {
+		if(!table->records[i].key || (stale && table->records[i].generation != table->generation))
+			continue;
+		
+		record	= wb_filetable_slot(records, capacity, table->records[i].key);
+		*record	= table->records[i];
+		
+		if(record->name)
+			record->name = wb_filetable_append_name(table, names + record->name - 1);
+	}
+	
+	wi_free(names);
+	wi_free(table->records);
+	
+	table->records	= records;
+	table->capacity	= capacity;
+	table->count	= count;
+}
+
+
+
+static wb_file_record_t * wb_filetable_slot(wb_file_record_t *records, wi_uinteger_t capacity, uint64_t key) {
+	wi_uinteger_t		mask, i;
+	
+	mask	= capacity - 1;
+	i		= (wi_uinteger_t) (key ^ (key >> 32)) & mask;
+	
+	while(records[i].key && records[i].key != key)
+		i = (i + 1) & mask;
+	
+	return &records[i];
+}
+
+
+
+static uint32_t wb_filetable_append_name(wb_filetable_t *table, const char *name) {
+	wi_uinteger_t		length, offset;
+	
+	length = strlen(name) + 1;
+	
+	if(table->names_length + length > table->names_capacity) {
+		while(table->names_length + length > table->names_capacity)
+			table->names_capacity = table->names_capacity ? table->names_capacity * 2 : 256;
+		
+		table->names = wi_realloc(table->names, table->names_capacity);
+	}
+	
+	offset = table->names_length;
+	
+	memcpy(table->names + offset, name, length);
+	
+	table->names_length += length;
+	
+	// offsets are stored one up, 0 is a record without a name
+	return (uint32_t) offset + 1;
+}
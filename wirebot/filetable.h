@@ -0,0 +1,84 @@
+/* $Id$ */
+
+/*
+ *  Copyright (c) 2012 Rafael Warnault
+ *  All rights reserved.
+ * 
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef WR_FILETABLE_H
+#define WR_FILETABLE_H 1
+
+#include <stdint.h>
+#include <wired/wired.h>
+
+/**
+ * Whether a listed file has been announced yet
+ */
+enum _wb_file_state {
+	WB_FILE_KNOWN					= 0,
+	WB_FILE_PENDING,
+	WB_FILE_PARTIAL
+};
+typedef enum _wb_file_state			wb_file_state_t;
+
+/**
+ * What a watcher remembers of one file, 32 bytes
+ */
+struct _wb_file_record {
+	uint64_t						key;
+	uint64_t						size;
+	uint32_t						mtime;
+	uint32_t						changed;
+	uint32_t						name;
+	uint16_t						generation;
+	uint8_t							type;
+	uint8_t							state;
+};
+typedef struct _wb_file_record		wb_file_record_t;
+
+typedef struct _wb_filetable		wb_filetable_t;
+
+
+void								wb_filetables_init(void);
+
+wb_filetable_t *					wb_filetable_alloc(void);
+wb_filetable_t *					wb_filetable_init(wb_filetable_t *);
+
+uint64_t							wb_filetable_key(wi_string_t *);
+
+wb_file_record_t *					wb_filetable_record(wb_filetable_t *, uint64_t);
+wb_file_record_t *					wb_filetable_add_record(wb_filetable_t *, uint64_t, wi_boolean_t *);
+void								wb_filetable_set_name(wb_filetable_t *, wb_file_record_t *, wi_string_t *);
+wi_string_t *						wb_filetable_name(wb_filetable_t *, wb_file_record_t *);
+
+void								wb_filetable_begin_listing(wb_filetable_t *);
+wi_boolean_t						wb_filetable_is_listing(wb_filetable_t *);
+uint16_t							wb_filetable_generation(wb_filetable_t *);
+wi_uinteger_t						wb_filetable_end_listing(wb_filetable_t *, wi_mutable_array_t *);
+void								wb_filetable_cancel_listing(wb_filetable_t *);
+
+wi_uinteger_t						wb_filetable_count(wb_filetable_t *);
+wi_uinteger_t						wb_filetable_size(wb_filetable_t *);
+
+#endif /* WR_FILETABLE_H */
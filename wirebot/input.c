@@ -48,6 +48,7 @@ struct _wb_input {
 	wi_runtime_base_t				base;
 
 	wi_string_t						*message_name;
+	wr_message_id_t					message_id;
 	wi_string_t						*input;
 	wb_bot_comparison_method_t		comparison;
 	wi_boolean_t					case_sensitive;
@@ -107,6 +108,10 @@ wi_string_t * wb_input_message_name(wb_input_t *input) {
 	return input->message_name;
 }
 
+wr_message_id_t wb_input_message_id(wb_input_t *input) {
+	return input->message_id;
+}
+
 wi_string_t * wb_input_input(wb_input_t *input) {
 	return input->input;
 }
@@ -131,8 +136,13 @@ static wb_input_t * _wb_input_load_with_node(wb_input_t *input, xmlNodePtr node)
 	wi_string_t		*message_name, *input_string, *comparison, *sensitive;
 
 	message_name = wi_xml_node_attribute_with_name(node, WI_STR("message"));
-	if(message_name)
+	if(message_name) {
 		input->message_name = wi_retain(message_name);
+		input->message_id 	= wr_messages_id_for_name(message_name);
+
+		if(input->message_id == WR_MESSAGE_UNKNOWN)
+			wi_log_warn(WI_STR("Unknown message \"%@\" in input, it will never match"), message_name);
+	}
 
 	comparison = wi_xml_node_attribute_with_name(node, WI_STR("comparison"));
 	if(comparison)
@@ -35,6 +35,8 @@
 #include <libxml/xpath.h>
 #include <wired/wired.h>
 
+#include "messages.h"
+
 
 /**
  * Comparison method wirebot use to match
@@ -60,6 +62,7 @@ wb_input_t * 						wb_input_alloc(void);
 wb_input_t *						wb_input_init(wb_input_t *, xmlNodePtr);
 
 wi_string_t * 						wb_input_message_name(wb_input_t *);
+wr_message_id_t						wb_input_message_id(wb_input_t *);
 wi_string_t *						wb_input_input(wb_input_t *);
 wb_bot_comparison_method_t			wb_input_comparison(wb_input_t *);
 wi_boolean_t						wb_input_is_case_sensitive(wb_input_t *);
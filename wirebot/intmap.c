@@ -0,0 +1,292 @@
+/* $Id$ */
+
+/*
+ *  Copyright (c) 2012 Rafael Warnault
+ *  All rights reserved.
+ * 
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "config.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <wired/wired.h>
+
+#include "intmap.h"
+
+/*
+	An open addressing map from 32-bit ids to runtime instances, for the
+	chat and user tables that are hit several times per message. Keys are
+	stored unboxed, so a lookup allocates nothing and probes a contiguous
+	array. Values are retained and released like in a wi_dictionary_t.
+	
+	Collisions use linear probing and removal shifts the following entries
+	back, so there are no tombstones and lookups never degrade over time.
+*/
+
+#define WR_INTMAP_MIN_CAPACITY			16
+
+struct _wr_intmap_entry {
+	uint32_t						key;
+	uint32_t						used;
+	void							*data;
+};
+typedef struct _wr_intmap_entry		wr_intmap_entry_t;
+
+struct _wr_intmap {
+	wr_intmap_entry_t				*entries;
+	size_t							capacity;
+	size_t							count;
+};
+
+
+static uint32_t						wr_intmap_hash(uint32_t);
+static wr_intmap_entry_t *			wr_intmap_entries_create(size_t);
+static void							wr_intmap_grow(wr_intmap_t *);
+
+
+
+wr_intmap_t * wr_intmap_create(size_t capacity) {
+	wr_intmap_t		*map;
+	size_t			size;
+	
+	// keep the table at most half full up to the requested capacity
+	size = WR_INTMAP_MIN_CAPACITY;
+	
+	while(size < capacity * 2)
+		size *= 2;
+	
+	map				= wi_malloc(sizeof(wr_intmap_t));
+	map->entries	= wr_intmap_entries_create(size);
+	map->capacity	= size;
+	map->count		= 0;
+	
+	return map;
+}
+
+
+
+void wr_intmap_destroy(wr_intmap_t *map) {
+	if(!map)
+		return;
+	
+	wr_intmap_remove_all_data(map);
+	
+	wi_free(map->entries);
+	wi_free(map);
+}
+
+
+
+#pragma mark -
+
+void * wr_intmap_data_for_key(wr_intmap_t *map, uint32_t key) {
+	wr_intmap_entry_t	*entry;
+	size_t				mask, i;
+	
+	mask	= map->capacity - 1;
+	i		= wr_intmap_hash(key) & mask;
+	
+	for(entry = &map->entries[i]; entry->used; entry = &map->entries[i]) {
+		if(entry->key == key)
+			return entry->data;
+		
+		i = (i + 1) & mask;
+	}
+	
+	return NULL;
+}
+
+
+
+void wr_intmap_set_data_for_key(wr_intmap_t *map, void *data, uint32_t key) {
+	wr_intmap_entry_t	*entry;
+	void				*old;
+	size_t				mask, i;
+	
+	if((map->count + 1) * 4 > map->capacity * 3)
+		wr_intmap_grow(map);
+	
+	mask	= map->capacity - 1;
+	i		= wr_intmap_hash(key) & mask;
+	
+	for(entry = &map->entries[i]; entry->used; entry = &map->entries[i]) {
+		if(entry->key == key) {
+			old			= entry->data;
+			entry->data	= wi_retain(data);
+			
+			wi_release(old);
+			
+			return;
+		}
+		
+		i = (i + 1) & mask;
+	}
+	
+	entry->key		= key;
+	entry->used		= 1;
+	entry->data		= wi_retain(data);
+	
+	map->count++;
+}
+
+
+
+void wr_intmap_remove_data_for_key(wr_intmap_t *map, uint32_t key) {
+	wr_intmap_entry_t	*entry;
+	void				*data;
+	size_t				mask, i, j, home;
+	
+	mask	= map->capacity - 1;
+	i		= wr_intmap_hash(key) & mask;
+	
+	for(entry = &map->entries[i]; entry->used; entry = &map->entries[i]) {
+		if(entry->key == key)
+			break;
+		
+		i = (i + 1) & mask;
+	}
+	
+	if(!entry->used)
+		return;
+	
+	data = entry->data;
+	
+	// shift back every following entry that would no longer be reachable
+	// through the hole, which keeps probe chains unbroken
+	j = i;
+	
+	while(true) {
+		j = (j + 1) & mask;
+		
+		if(!map->entries[j].used)
+			break;
+		
+		home = wr_intmap_hash(map->entries[j].key) & mask;
+		
+		if((j > i && (home <= i || home > j)) || (j < i && (home <= i && home > j))) {
+			map->entries[i]	= map->entries[j];
+			i				= j;
+		}
+	}
+	
+	memset(&map->entries[i], 0, sizeof(wr_intmap_entry_t));
+	
+	map->count--;
+	
+	wi_release(data);
+}
+
+
+
+void wr_intmap_remove_all_data(wr_intmap_t *map) {
+	size_t		i;
+	
+	for(i = 0; i < map->capacity; i++) {
+		if(map->entries[i].used)
+			wi_release(map->entries[i].data);
+	}
+	
+	memset(map->entries, 0, map->capacity * sizeof(wr_intmap_entry_t));
+	
+	map->count = 0;
+}
+
+
+
+#pragma mark -
+
+size_t wr_intmap_count(wr_intmap_t *map) {
+	return map->count;
+}
+
+
+
+wi_array_t * wr_intmap_all_data(wr_intmap_t *map) {
+	wi_mutable_array_t	*array;
+	size_t				i;
+	
+	array = wi_array_init_with_capacity(wi_mutable_array_alloc(), map->count);
+	
+	for(i = 0; i < map->capacity; i++) {
+		if(map->entries[i].used)
+			wi_mutable_array_add_data(array, map->entries[i].data);
+	}
+	
+	return wi_autorelease(array);
+}
+
+
+
+#pragma mark -
+
+static uint32_t wr_intmap_hash(uint32_t key) {
+	// ids are small and sequential, mix them so they spread over the table
+	key ^= key >> 16;
+	key *= 0x7feb352d;
+	key ^= key >> 15;
+	key *= 0x846ca68b;
+	key ^= key >> 16;
+	
+	return key;
+}
+
+
+
+static wr_intmap_entry_t * wr_intmap_entries_create(size_t capacity) {
+	wr_intmap_entry_t	*entries;
+	
+	entries = wi_malloc(capacity * sizeof(wr_intmap_entry_t));
+	
+	memset(entries, 0, capacity * sizeof(wr_intmap_entry_t));
+	
+	return entries;
+}
+
+
+
+static void wr_intmap_grow(wr_intmap_t *map) {
+	wr_intmap_entry_t	*entries;
+	size_t				capacity, mask, i, j;
+	
+	entries			= map->entries;
+	capacity		= map->capacity;
+	map->capacity	= capacity * 2;
+	map->entries	= wr_intmap_entries_create(map->capacity);
+	mask			= map->capacity - 1;
+	
+	// move entries over as they are, their retain is carried along
+	for(i = 0; i < capacity; i++) {
+		if(!entries[i].used)
+			continue;
+		
+		j = wr_intmap_hash(entries[i].key) & mask;
+		
+		while(map->entries[j].used)
+			j = (j + 1) & mask;
+		
+		map->entries[j] = entries[i];
+	}
+	
+	wi_free(entries);
+}
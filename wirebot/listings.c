@@ -0,0 +1,552 @@
+/* $Id$ */
+
+/*
+ *  Copyright (c) 2012 Rafael Warnault
+ *  All rights reserved.
+ * 
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "config.h"
+
+#include <sys/resource.h>
+#include <wired/wired.h>
+
+#include "client.h"
+#include "connection.h"
+#include "intmap.h"
+#include "listings.h"
+#include "settings.h"
+#include "spec.h"
+
+/*
+	Listings of watched directories. Each path has at most one entry here,
+	which goes through these states:
+	
+	  queued     an initial listing waits for a free slot
+	  pending    a change was seen, the relisting waits for the directory
+	             to settle
+	  in flight  list_directory was sent, replies are expected
+	
+	A directory_changed does not list the directory right away: the change
+	is held for "watcher debounce" seconds, and every further change of the
+	same path during that window pushes the listing back, up to "watcher max
+	delay" seconds after the first one. An upload of many files then costs
+	one listing instead of one per file. A change arriving while a listing
+	is in flight marks the path to be listed once more when it is done.
+	
+	At most "watcher listings" listings are in flight at once. Each carries
+	its own transaction, so the replies tell an initial listing from a
+	relisting even when several watchers list at the same time. Queued
+	listings are sent first in, first out, after any relisting that is due,
+	so a recursive watcher walks its tree breadth first while the changes
+	of directories already known still go out quickly.
+*/
+
+enum _wb_listing_state {
+	WB_LISTING_IDLE					= 0,
+	WB_LISTING_QUEUED,
+	WB_LISTING_PENDING,
+	WB_LISTING_IN_FLIGHT
+};
+typedef enum _wb_listing_state		wb_listing_state_t;
+
+struct _wb_listing {
+	wi_runtime_base_t				base;
+	
+	wi_string_t						*path;
+	wb_listing_state_t				state;
+	wb_listing_kind_t				kind;
+	wi_p7_uint32_t					transaction;
+	wi_boolean_t					rerun;
+	wi_boolean_t					subscribe;
+	
+	wi_time_interval_t				first_change_time;
+	wi_time_interval_t				due_time;
+};
+typedef struct _wb_listing			wb_listing_t;
+
+static wb_listing_t *				wb_listing_with_path(wi_string_t *);
+static wb_listing_t *				wb_listing_for_message(wi_p7_message_t *, wi_string_t *);
+static void							wb_listing_dealloc(wi_runtime_instance_t *);
+static void							wb_listing_schedule(wb_listing_t *, wi_time_interval_t);
+static void							wb_listing_send(wb_listing_t *, wr_connection_t *, wi_time_interval_t);
+static void							wb_listing_finish(wb_listing_t *);
+
+static wi_mutable_dictionary_t		*wb_listings;
+static wi_mutable_array_t			*wb_listings_pending;
+static wi_mutable_array_t			*wb_listings_queued;
+static wi_uinteger_t				wb_listings_queued_head;
+static wr_intmap_t					*wb_listings_transactions;
+static wi_uinteger_t				wb_listings_in_flight;
+
+static wi_uinteger_t				wb_listings_arming;
+static wi_uinteger_t				wb_listings_armed;
+static wi_time_interval_t			wb_listings_arming_time;
+static wi_time_interval_t			wb_listings_armed_time;
+
+static wi_uinteger_t				wb_listings_changes;
+static wi_uinteger_t				wb_listings_sent;
+static wi_time_interval_t			wb_listings_latency;
+static wi_time_interval_t			wb_listings_latency_max;
+
+static wi_runtime_id_t				wb_listing_runtime_id = WI_RUNTIME_ID_NULL;
+static wi_runtime_class_t			wb_listing_runtime_class = {
+	"wb_listing_t",
+	wb_listing_dealloc,
+	NULL,
+	NULL,
+	NULL,
+	NULL
+};
+
+
+
+void wb_listings_init(void) {
+	wb_listing_runtime_id = wi_runtime_register_class(&wb_listing_runtime_class);
+	
+	wb_listings					= wi_dictionary_init(wi_mutable_dictionary_alloc());
+	wb_listings_pending			= wi_array_init(wi_mutable_array_alloc());
+	wb_listings_queued			= wi_array_init(wi_mutable_array_alloc());
+	wb_listings_transactions	= wr_intmap_create(0);
+}
+
+
+
+#pragma mark -
+
+void wb_listings_queue(wi_string_t *path, wb_listing_kind_t kind, wi_boolean_t subscribe) {
+	wb_listing_t			*listing;
+	
+	listing = wi_dictionary_data_for_key(wb_listings, path);
+	
+	if(!listing) {
+		listing = wb_listing_with_path(path);
+		
+		wi_mutable_dictionary_set_data_for_key(wb_listings, listing, path);
+	}
+	else if(listing->state == WB_LISTING_IN_FLIGHT || listing->state == WB_LISTING_QUEUED) {
+		// the listing under way will do
+		listing->subscribe = listing->subscribe || subscribe;
+		
+		return;
+	}
+	else if(listing->state == WB_LISTING_PENDING) {
+		wi_mutable_array_remove_data(wb_listings_pending, listing);
+	}
+	
+	if(kind == WB_LISTING_INITIAL) {
+		if(wb_listings_arming == 0)
+			wb_listings_arming_time = wi_time_interval();
+		
+		wb_listings_arming++;
+	}
+	
+	listing->state				= WB_LISTING_QUEUED;
+	listing->kind				= kind;
+	listing->subscribe			= subscribe;
+	listing->first_change_time	= wi_time_interval();
+	
+	wi_mutable_array_add_data(wb_listings_queued, listing);
+}
+
+
+
+void wb_listings_note_change(wi_string_t *path) {
+	wb_listing_t			*listing;
+	wi_time_interval_t		interval;
+	
+	listing		= wi_dictionary_data_for_key(wb_listings, path);
+	interval	= wi_time_interval();
+	
+	wb_listings_changes++;
+	
+	if(!listing) {
+		listing = wb_listing_with_path(path);
+		
+		wi_mutable_dictionary_set_data_for_key(wb_listings, listing, path);
+	}
+	
+	switch(listing->state) {
+		case WB_LISTING_IDLE:
+			listing->kind				= WB_LISTING_RELIST;
+			listing->first_change_time	= interval;
+			wb_listing_schedule(listing, interval);
+			break;
+		
+		case WB_LISTING_QUEUED:
+			// the initial listing has not been sent yet and will see the change
+			break;
+		
+		case WB_LISTING_PENDING:
+			wb_listing_schedule(listing, interval);
+			break;
+		
+		case WB_LISTING_IN_FLIGHT:
+			if(!listing->rerun) {
+				listing->rerun				= true;
+				listing->first_change_time	= interval;
+			}
+			break;
+	}
+}
+
+
+
+void wb_listings_recheck(wi_string_t *path, wi_time_interval_t delay) {
+	wb_listing_t			*listing;
+	
+	listing = wi_dictionary_data_for_key(wb_listings, path);
+	
+	if(!listing) {
+		listing = wb_listing_with_path(path);
+		
+		wi_mutable_dictionary_set_data_for_key(wb_listings, listing, path);
+	}
+	
+	// any listing already on its way sees the files as well
+	if(listing->state != WB_LISTING_IDLE)
+		return;
+	
+	listing->state		= WB_LISTING_PENDING;
+	listing->kind		= WB_LISTING_RELIST;
+	listing->due_time	= wi_time_interval() + delay;
+	
+	// not a change, so it does not count as added latency
+	listing->first_change_time = listing->due_time;
+	
+	wi_mutable_array_add_data(wb_listings_pending, listing);
+}
+
+
+
+wb_listing_kind_t wb_listings_kind_for_message(wi_p7_message_t *message, wi_string_t *path) {
+	wb_listing_t			*listing;
+	
+	listing = wb_listing_for_message(message, path);
+	
+	return listing ? listing->kind : WB_LISTING_NONE;
+}
+
+
+
+wb_listing_kind_t wb_listings_note_done(wi_p7_message_t *message, wi_string_t *path) {
+	wb_listing_t			*listing;
+	wb_listing_kind_t		kind;
+	
+	listing = wb_listing_for_message(message, path);
+	
+	if(!listing)
+		return WB_LISTING_NONE;
+	
+	kind = listing->kind;
+	
+	wb_listing_finish(listing);
+	
+	return kind;
+}
+
+
+
+wb_listing_kind_t wb_listings_note_error(wi_p7_message_t *message, wi_string_t **path) {
+	wb_listing_t			*listing;
+	wb_listing_kind_t		kind;
+	wi_p7_uint32_t			transaction;
+	
+	// errors carry nothing but the transaction of the request
+	if(!wi_p7_message_get_uint32_for_name(message, &transaction, WI_STR("wired.transaction")) || transaction == 0)
+		return WB_LISTING_NONE;
+	
+	listing = wr_intmap_data_for_key(wb_listings_transactions, transaction);
+	
+	if(!listing)
+		return WB_LISTING_NONE;
+	
+	kind	= listing->kind;
+	*path	= wi_autorelease(wi_retain(listing->path));
+	
+	// the slot is freed and an initial listing still counts towards arming,
+	// a change seen meanwhile tries again
+	wb_listing_finish(listing);
+	
+	return kind;
+}
+
+
+
+void wb_listings_reset(void) {
+	// replies to listings in flight will never come, and the initial
+	// listings of the next connect see every change made until then
+	wi_mutable_dictionary_remove_all_data(wb_listings);
+	wi_mutable_array_remove_all_data(wb_listings_pending);
+	wi_mutable_array_remove_all_data(wb_listings_queued);
+	wr_intmap_remove_all_data(wb_listings_transactions);
+	
+	wb_listings_queued_head	= 0;
+	
+	wb_listings_in_flight	= 0;
+	wb_listings_arming		= 0;
+	wb_listings_armed		= 0;
+}
+
+
+
+#pragma mark -
+
+wi_time_interval_t wb_listings_timeout(void) {
+	wi_enumerator_t			*enumerator;
+	wb_listing_t			*listing;
+	wi_time_interval_t		interval, timeout;
+	
+	// nothing is sent until the first server is back, the reconnect
+	// wakes us up
+	if(!wr_connections_first() || !wr_connections_first()->connected)
+		return 30.0;
+	
+	// queued listings go out as soon as a reply frees a slot, which wakes
+	// up the runloop anyway
+	if(wb_listings_queued_head < wi_array_count(wb_listings_queued) && wb_listings_in_flight == 0)
+		return 0.1;
+	
+	interval	= wi_time_interval();
+	timeout		= 30.0;
+	enumerator	= wi_array_data_enumerator(wb_listings_pending);
+	
+	while((listing = wi_enumerator_next_data(enumerator))) {
+		if(listing->due_time - interval < timeout)
+			timeout = listing->due_time - interval;
+	}
+	
+	if(timeout < 0.1)
+		timeout = 0.1;
+	
+	return timeout;
+}
+
+
+
+void wb_listings_run(void) {
+	wr_connection_t			*connection;
+	wb_listing_t			*listing;
+	wi_time_interval_t		interval;
+	wi_uinteger_t			i, count, limit;
+	
+	if(wi_dictionary_count(wb_listings) == 0)
+		return;
+	
+	// watchers are served by the first configured server
+	connection = wr_connections_first();
+	
+	if(!connection || !connection->connected)
+		return;
+	
+	limit = wi_config_integer_for_name(wd_config, WI_STR("watcher listings"));
+	
+	if(limit == 0)
+		limit = 1;
+	
+	interval	= wi_time_interval();
+	count		= wi_array_count(wb_listings_pending);
+	
+	// relistings that are due first, they are what announcements wait on
+	for(i = count; i > 0 && wb_listings_in_flight < limit; i--) {
+		listing = WI_ARRAY(wb_listings_pending, i - 1);
+		
+		if(listing->due_time <= interval) {
+			wi_retain(listing);
+			wi_mutable_array_remove_data_at_index(wb_listings_pending, i - 1);
+			wb_listing_send(listing, connection, interval);
+			wi_release(listing);
+		}
+	}
+	
+	count = wi_array_count(wb_listings_queued);
+	
+	while(wb_listings_in_flight < limit && wb_listings_queued_head < count) {
+		listing = WI_ARRAY(wb_listings_queued, wb_listings_queued_head++);
+		
+		if(listing->state == WB_LISTING_QUEUED)
+			wb_listing_send(listing, connection, interval);
+	}
+	
+	// drop the sent part of the queue once in a while rather than shifting
+	// the array on every send
+	if(wb_listings_queued_head == count || wb_listings_queued_head > 1024) {
+		wi_mutable_array_remove_data_in_range(wb_listings_queued, wi_make_range(0, wb_listings_queued_head));
+		
+		wb_listings_queued_head = 0;
+	}
+}
+
+
+
+void wb_listings_log_statistics(void) {
+	wi_log_info(WI_STR("Watchers: %u directory changes, %u listings sent, %u avoided, added latency avg %.3f seconds, max %.3f seconds, last armed in %.3f seconds"),
+		wb_listings_changes,
+		wb_listings_sent,
+		wb_listings_changes > wb_listings_sent ? wb_listings_changes - wb_listings_sent : 0,
+		wb_listings_sent > 0 ? wb_listings_latency / wb_listings_sent : 0.0,
+		wb_listings_latency_max,
+		wb_listings_armed_time);
+}
+
+
+
+#pragma mark -
+
+static wb_listing_t * wb_listing_with_path(wi_string_t *path) {
+	wb_listing_t		*listing;
+	
+	listing			= wi_runtime_create_instance(wb_listing_runtime_id, sizeof(wb_listing_t));
+	listing->path	= wi_copy(path);
+	listing->state	= WB_LISTING_IDLE;
+	
+	return wi_autorelease(listing);
+}
+
+
+
+static wb_listing_t * wb_listing_for_message(wi_p7_message_t *message, wi_string_t *path) {
+	wb_listing_t		*listing;
+	wi_p7_uint32_t		transaction;
+	
+	// replies carry the transaction of their request, a reply to a
+	// transaction we no longer track belongs to no listing; only servers
+	// that do not echo it are matched by path
+	if(wi_p7_message_get_uint32_for_name(message, &transaction, WI_STR("wired.transaction")) && transaction > 0)
+		return wr_intmap_data_for_key(wb_listings_transactions, transaction);
+	
+	listing = wi_dictionary_data_for_key(wb_listings, path);
+	
+	if(listing && listing->state == WB_LISTING_IN_FLIGHT)
+		return listing;
+	
+	return NULL;
+}
+
+
+
+static void wb_listing_dealloc(wi_runtime_instance_t *instance) {
+	wb_listing_t		*listing = instance;
+	
+	wi_release(listing->path);
+}
+
+
+
+static void wb_listing_schedule(wb_listing_t *listing, wi_time_interval_t interval) {
+	wi_time_interval_t		debounce, deadline;
+	
+	debounce	= wi_config_integer_for_name(wd_config, WI_STR("watcher debounce"));
+	deadline	= listing->first_change_time + wi_config_integer_for_name(wd_config, WI_STR("watcher max delay"));
+	
+	if(listing->state != WB_LISTING_PENDING)
+		wi_mutable_array_add_data(wb_listings_pending, listing);
+	
+	listing->state		= WB_LISTING_PENDING;
+	listing->due_time	= WI_MIN(interval + debounce, deadline);
+}
+
+
+
+static void wb_listing_send(wb_listing_t *listing, wr_connection_t *connection, wi_time_interval_t interval) {
+	wi_p7_message_t			*message;
+	wi_time_interval_t		latency;
+	
+	if(listing->subscribe) {
+		message = wi_p7_message_with_name(WI_STR("wired.file.subscribe_directory"), wr_p7_spec);
+		wi_p7_message_set_string_for_name(message, listing->path, WI_STR("wired.file.path"));
+		
+		wr_client_send_message_on_connection(connection, message);
+		
+		listing->subscribe = false;
+	}
+	
+	listing->transaction = wr_client_next_transaction();
+	
+	message = wi_p7_message_with_name(WI_STR("wired.file.list_directory"), wr_p7_spec);
+	wi_p7_message_set_string_for_name(message, listing->path, WI_STR("wired.file.path"));
+	wi_p7_message_set_uint32_for_name(message, listing->transaction, WI_STR("wired.transaction"));
+	
+	wr_client_send_message_on_connection(connection, message);
+	wr_intmap_set_data_for_key(wb_listings_transactions, listing, listing->transaction);
+	
+	wb_listings_in_flight++;
+	listing->state = WB_LISTING_IN_FLIGHT;
+	
+	if(listing->kind == WB_LISTING_RELIST) {
+		latency = interval - listing->first_change_time;
+		
+		wb_listings_sent++;
+		wb_listings_latency += latency;
+		
+		if(latency > wb_listings_latency_max)
+			wb_listings_latency_max = latency;
+		
+		wi_log_debug(WI_STR("Relisting %@ after %.3f seconds"), listing->path, latency);
+	} else {
+		wi_log_debug(WI_STR("Listing %@"), listing->path);
+	}
+}
+
+
+
+static void wb_listing_finish(wb_listing_t *listing) {
+	wi_time_interval_t		interval;
+	struct rusage			usage;
+	
+	wr_intmap_remove_data_for_key(wb_listings_transactions, listing->transaction);
+	wb_listings_in_flight--;
+	
+	if(listing->kind == WB_LISTING_INITIAL && wb_listings_arming > 0) {
+		wb_listings_armed++;
+		
+		if(--wb_listings_arming == 0) {
+			wb_listings_armed_time = wi_time_interval() - wb_listings_arming_time;
+			
+			// ru_maxrss is in kilobytes on Linux and bytes on Darwin
+			if(getrusage(RUSAGE_SELF, &usage) < 0)
+				usage.ru_maxrss = 0;
+			
+			wi_log_info(WI_STR("Watchers armed: %u directories listed in %.3f seconds, process peak RSS %ld"),
+				wb_listings_armed, wb_listings_armed_time, usage.ru_maxrss);
+			
+			wb_listings_armed = 0;
+		}
+	}
+	
+	if(listing->rerun) {
+		interval			= wi_time_interval();
+		listing->rerun		= false;
+		listing->kind		= WB_LISTING_RELIST;
+		
+		wb_listing_schedule(listing, interval);
+	} else {
+		// the dictionary holds the last reference, keep the path alive
+		// while it is removed
+		wi_autorelease(wi_retain(listing));
+		
+		listing->state		= WB_LISTING_IDLE;
+		
+		wi_mutable_dictionary_remove_data_for_key(wb_listings, listing->path);
+	}
+}
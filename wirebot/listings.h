@@ -0,0 +1,60 @@
+/* $Id$ */
+
+/*
+ *  Copyright (c) 2012 Rafael Warnault
+ *  All rights reserved.
+ * 
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef WR_LISTINGS_H
+#define WR_LISTINGS_H 1
+
+#include <wired/wired.h>
+
+/**
+ * Why a directory is being listed
+ */
+enum _wb_listing_kind {
+	WB_LISTING_NONE					= 0,
+	WB_LISTING_INITIAL,
+	WB_LISTING_RELIST
+};
+typedef enum _wb_listing_kind		wb_listing_kind_t;
+
+
+void								wb_listings_init(void);
+
+void								wb_listings_queue(wi_string_t *, wb_listing_kind_t, wi_boolean_t);
+void								wb_listings_note_change(wi_string_t *);
+void								wb_listings_recheck(wi_string_t *, wi_time_interval_t);
+wb_listing_kind_t					wb_listings_kind_for_message(wi_p7_message_t *, wi_string_t *);
+wb_listing_kind_t					wb_listings_note_done(wi_p7_message_t *, wi_string_t *);
+wb_listing_kind_t					wb_listings_note_error(wi_p7_message_t *, wi_string_t **);
+void								wb_listings_reset(void);
+
+wi_time_interval_t					wb_listings_timeout(void);
+void								wb_listings_run(void);
+
+void								wb_listings_log_statistics(void);
+
+#endif /* WR_LISTINGS_H */
@@ -29,8 +29,11 @@
 #include "config.h"
 
 #include <syslog.h>
+#include <errno.h>
+#include <fcntl.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <unistd.h>
 #include <readline/readline.h>
 #include <wired/wired.h>
@@ -38,6 +41,7 @@
 #include "chats.h"
 #include "client.h"
 #include "commands.h"
+#include "connection.h"
 #include "ignores.h"
 #include "main.h"
 #include "messages.h"
@@ -50,6 +54,12 @@
 #include "transfers.h"
 #include "settings.h"
 #include "service.h"
+#include "seen.h"
+#include "listings.h"
+#include "snapshot.h"
+#include "servicecache.h"
+#include "filetable.h"
+#include "watcher.h"
 
 static void							wr_cleanup(void);
 static void							wr_usage(void);
@@ -67,38 +77,35 @@ static void							wr_sig_int(int);
 static void							wr_sig_crash(int);
 
 static void							wr_log_callback(wi_log_level_t, wi_string_t *);
+static void							wr_log_statistics(void);
 
 static wi_integer_t					wr_runloop(wi_array_t *, wi_time_interval_t);
 static wi_boolean_t					wr_runloop_stdin_callback(wi_socket_t *);
+static wi_boolean_t					wr_runloop_wakeup_callback(wi_socket_t *);
 
 
 static wi_mutable_array_t			*wr_runloop_sockets;
+static int							wr_runloop_wakeup_pipe[2] = { -1, -1 };
 
 volatile sig_atomic_t				wr_running = 1;
+static volatile sig_atomic_t		wr_statistics_requested;
+static volatile sig_atomic_t		wr_reload_requested;
 
 wi_boolean_t						wr_debug;
 wi_date_t							*wr_start_date;
 wi_string_t							*wr_config_path;
 
-wi_string_t							*wb_hostname;
-wi_string_t							*wb_login;
-wi_string_t							*wb_password;
-wi_integer_t						wb_port;
-
 wb_bot_t							*wb_bot;
 
 
 int main(int argc, const char **argv) {
 	wi_pool_t				*pool;
 	wi_mutable_array_t		*arguments;
-	wi_string_t				*homepath, *wirepath, *path, *component;
+	wi_string_t				*homepath, *wirepath, *seenpath, *snapshotpath, *cachepath, *path, *component;
 	wi_file_t				*file;	
 	wi_boolean_t			daemonize;
 	int						ch;
 
-	wi_string_t *hostname, *login, *password;
-	wi_uinteger_t port;
-
 	wi_initialize();
 	wi_load(argc, argv);
 	
@@ -112,8 +119,6 @@ int main(int argc, const char **argv) {
 
 	daemonize				= true;
 
-	wr_spec_init();
-
 	while((ch = getopt(argc, (char * const *) argv, "Ddc:hVvXx")) != -1) {
 
 		switch(ch) {
@@ -179,6 +184,9 @@ int main(int argc, const char **argv) {
 	wi_release(arguments);
 
 	wi_log_open();
+
+	// parsed after the fork and exec above, so a daemon only pays for it once
+	wr_spec_init();
 	
 	homepath = wi_user_home();
 	wirepath = wi_string_by_appending_path_component(homepath, WI_STR(WB_WIREBOT_USER_PATH));
@@ -200,11 +208,41 @@ int main(int argc, const char **argv) {
 	wb_inputs_init();
 	wb_services_init();
 	wb_watchers_init();
+	wb_filetables_init();
+	wb_listings_init();
 	wb_rules_init();
 	wb_commands_init();
 
-	wr_readline_init();
+	// relative paths live in the wirebot folder like the icon
+	seenpath = wi_config_path_for_name(wd_config, WI_STR("seen path"));
+
+	if(!wi_string_has_prefix(seenpath, WI_STR("/")))
+		seenpath = wi_string_by_appending_path_component(wirepath, seenpath);
+
+	if(!wb_seen_open(seenpath))
+		wi_log_warn(WI_STR("!seen is not available"));
+
+	snapshotpath = wi_config_path_for_name(wd_config, WI_STR("snapshot path"));
+
+	if(!wi_string_has_prefix(snapshotpath, WI_STR("/")))
+		snapshotpath = wi_string_by_appending_path_component(wirepath, snapshotpath);
+
+	if(!wb_snapshots_open(snapshotpath))
+		wi_log_warn(WI_STR("Watcher snapshots are not available"));
+
+	cachepath = wi_config_path_for_name(wd_config, WI_STR("service cache path"));
+
+	if(!wi_string_has_prefix(cachepath, WI_STR("/")))
+		cachepath = wi_string_by_appending_path_component(wirepath, cachepath);
+
+	if(!wb_service_cache_open(cachepath))
+		wi_log_warn(WI_STR("Service results will not be cached"));
+
 	wr_chats_init();
+	wr_connections_init();
+	wr_connections_load_config();
+
+	wr_readline_init();
 	wr_commands_initialize();
 
 	wr_client_init();
@@ -222,18 +260,17 @@ int main(int argc, const char **argv) {
 	wr_signals_init();
 	wd_block_signals();
 
-	// connect
-	wb_hostname 	= wi_retain(wi_config_string_for_name(wd_config, WI_STR("hostname")));
-	wb_login		= wi_retain(wi_config_string_for_name(wd_config, WI_STR("login")));
-	wb_password		= wi_retain(wi_config_string_for_name(wd_config, WI_STR("password")));
-	wb_port			= wi_config_port_for_name(wd_config, WI_STR("port"));
-
-	wr_client_connect(wb_hostname, wb_port, wb_login, wb_password);	
+	// connect to every configured server, all of them are served from
+	// the same runloop and share the dictionary loaded above
+	wr_client_connect_all();
 	wi_pool_drain(pool);
 
 	wi_thread_create_thread(wd_signal_thread, NULL);
 	wr_runloop_run();
 
+	// connections belong to the runloop thread, they are closed once it
+	// has stopped rather than from the signal thread
+	wr_client_disconnect_all();
 	wr_cleanup();
 	wi_release(pool);
 	
@@ -243,11 +280,11 @@ int main(int argc, const char **argv) {
 
 
 static void wr_cleanup(void) {
+	wb_seen_close();
+	wb_snapshots_close();
+	wb_services_cleanup();
+	wb_service_cache_close();
 	wb_delete_pid();
-
-	wi_release(wb_hostname);
-	wi_release(wb_login);
-	wi_release(wb_password);
 }
 
 
@@ -272,6 +309,8 @@ By Rafael Warnault <%s>\n", WR_BUGREPORT);
 
 
 static void wr_version(void) {
+	wr_spec_init();
+
 	fprintf(stderr, "Wirebot %s (%s), protocol %s %s\n",
 		WR_VERSION,
 		WI_REVISION,
@@ -344,19 +383,19 @@ void wd_signal_thread(wi_runtime_instance_t *arg) {
 			case SIGHUP:
 				wi_log_info(WI_STR("Signal HUP received, reloading configuration"));
 
-				wd_settings_read_config();
-				wr_client_reload_icon();
-				
-				if(wb_bot) {
-					wb_bot_reload_configuration(wb_bot);
-				}
+				// the bot state belongs to the runloop thread, let it reload
+				wr_reload_requested = 1;
+				wr_runloop_wakeup();
 
 				// wd_schedule();
 				break;
 				
 			case SIGUSR1:
-				wi_log_info(WI_STR("Signal USR1 received, TBD"));
-				//wd_trackers_register();
+				wi_log_info(WI_STR("Signal USR1 received, logging statistics"));
+
+				// the statistics belong to the runloop thread, let it log them
+				wr_statistics_requested = 1;
+				wr_runloop_wakeup();
 				break;
 
 			case SIGUSR2:
@@ -367,19 +406,19 @@ void wd_signal_thread(wi_runtime_instance_t *arg) {
 			case SIGINT:
 				wi_log_info(WI_STR("Signal INT received, quitting"));
 				wr_running = 0;
-				wr_client_disconnect();
+				wr_runloop_wakeup();
 				break;
 
 			case SIGQUIT:
 				wi_log_info(WI_STR("Signal QUIT received, quitting"));
 				wr_running = 0;
-				wr_client_disconnect();
+				wr_runloop_wakeup();
 				break;
 
 			case SIGTERM:
 				wi_log_info(WI_STR("Signal TERM received, quitting"));
 				wr_running = 0;
-				wr_client_disconnect();
+				wr_runloop_wakeup();
 				break;
 		}
 		
@@ -399,6 +438,16 @@ static void wr_log_callback(wi_log_level_t level, wi_string_t *string) {
 
 
 
+static void wr_log_statistics(void) {
+	wr_client_log_statistics();
+	wb_service_cache_log_statistics();
+
+	if(wb_bot)
+		wb_bot_log_statistics(wb_bot);
+}
+
+
+
 #pragma mark -
 
 char * wr_readline_bookmark_generator(const char *text, int state) {
@@ -506,7 +555,24 @@ static void wb_delete_pid(void) {
 #pragma mark -
 
 void wr_runloop_init(void) {
+	wi_socket_t		*socket;
+	
 	wr_runloop_sockets = wi_array_init(wi_mutable_array_alloc());
+	
+	// other threads write a byte here to cut the runloop's wait short
+	if(pipe(wr_runloop_wakeup_pipe) < 0) {
+		wi_log_warn(WI_STR("Could not create runloop pipe: %s"), strerror(errno));
+		
+		return;
+	}
+	
+	fcntl(wr_runloop_wakeup_pipe[0], F_SETFL, fcntl(wr_runloop_wakeup_pipe[0], F_GETFL) | O_NONBLOCK);
+	fcntl(wr_runloop_wakeup_pipe[1], F_SETFL, fcntl(wr_runloop_wakeup_pipe[1], F_GETFL) | O_NONBLOCK);
+	
+	socket = wi_socket_init_with_descriptor(wi_socket_alloc(), wr_runloop_wakeup_pipe[0]);
+	wi_socket_set_direction(socket, WI_SOCKET_READ);
+	wr_runloop_add_socket(socket, &wr_runloop_wakeup_callback);
+	wi_release(socket);
 }
 
 
@@ -525,10 +591,19 @@ void wr_runloop_remove_socket(wi_socket_t *socket) {
 
 
 
+void wr_runloop_wakeup(void) {
+	char		byte = 0;
+	
+	if(wr_runloop_wakeup_pipe[1] >= 0)
+		(void) write(wr_runloop_wakeup_pipe[1], &byte, 1);
+}
+
+
+
 static void wr_runloop_run(void) {
 	wi_pool_t			*pool;
 	wi_socket_t			*socket;
-	wi_time_interval_t	interval, ping_interval;
+	wi_time_interval_t	timeout;
 	wi_uinteger_t		i = 0;
 	wi_boolean_t		result;
 	
@@ -539,23 +614,34 @@ static void wr_runloop_run(void) {
 	wr_runloop_add_socket(socket, &wr_runloop_stdin_callback);
 	wi_release(socket);
 	
-	ping_interval = wi_time_interval();
-	
 	while(wr_running) {
-		result = wr_runloop(wr_runloop_sockets, 30.0);
+		timeout = WI_MIN(wr_client_keepalive_timeout(), WI_MIN(wb_listings_timeout(), wb_watchers_timeout()));
+		timeout = WI_MIN(timeout, wb_services_timeout());
+		result = wr_runloop(wr_runloop_sockets, timeout);
 		
-		if(!result && wr_connected) {
-			interval = wi_time_interval();
+		if(wr_reload_requested) {
+			wr_reload_requested = 0;
 			
-			if(interval - ping_interval > 60.0) {
-				wr_client_send_message(wi_p7_message_with_name(WI_STR("wired.send_ping"), wr_p7_spec));
-				
-				ping_interval = interval;
-			}
+			wd_settings_read_config();
+			wr_client_reload_icon();
 			
-			wi_pool_drain(pool);
+			if(wb_bot)
+				wb_bot_reload_configuration(wb_bot);
 		}
 		
+		wr_client_keepalive();
+		wb_listings_run();
+		wb_watchers_run();
+		wb_services_run();
+		
+		if(wr_statistics_requested) {
+			wr_statistics_requested = 0;
+			wr_log_statistics();
+		}
+		
+		if(!result)
+			wi_pool_drain(pool);
+		
 		if(++i % 100 == 0)
 			wi_pool_drain(pool);
 	}
@@ -604,3 +690,15 @@ static wi_boolean_t wr_runloop_stdin_callback(wi_socket_t *socket) {
 	
 	return true;
 }
+
+
+
+static wi_boolean_t wr_runloop_wakeup_callback(wi_socket_t *socket) {
+	char		buffer[64];
+	
+	// whatever woke us up is handled after the wait, by the runloop itself
+	while(read(wi_socket_descriptor(socket), buffer, sizeof(buffer)) > 0)
+		;
+	
+	return true;
+}
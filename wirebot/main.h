@@ -58,6 +58,7 @@ void									wr_runloop_init(void);
 
 void									wr_runloop_add_socket(wi_socket_t *, wr_runloop_callback_func_t *);
 void									wr_runloop_remove_socket(wi_socket_t *);
+void									wr_runloop_wakeup(void);
 
 static void								wr_runloop_run(void);
 void									wr_runloop_run_for_socket(wi_socket_t *, wi_time_interval_t, wi_uinteger_t);
@@ -70,11 +71,6 @@ extern wi_boolean_t						wr_debug;
 extern wi_date_t						*wr_start_date;
 extern wi_string_t						*wr_config_path;
 
-extern wi_string_t						*wb_hostname;
-extern wi_string_t						*wb_login;
-extern wi_string_t						*wb_password;
-extern wi_integer_t						wb_port;
-
 extern wb_bot_t							*wb_bot;
 
 #endif /* WR_MAIN_H */
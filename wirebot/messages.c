@@ -30,6 +30,7 @@
 
 #include <wired/wired.h>
 
+#include "arena.h"
 #include "main.h"
 #include "client.h"
 #include "commands.h"
@@ -38,6 +39,10 @@
 #include "spec.h"
 #include "windows.h"
 #include "bot.h"
+#include "seen.h"
+#include "listings.h"
+#include "snapshot.h"
+#include "files.h"
 #include "settings.h"
 
 
@@ -100,57 +105,110 @@ static void										wr_message_file_list(wi_p7_message_t *);
 static void										wr_message_file_list_done(wi_p7_message_t *);
 static void										wr_message_file_directory_changed(wi_p7_message_t *);
 
-static wi_mutable_dictionary_t					*wr_message_handlers;
+static wi_mutable_dictionary_t					*wr_message_ids;
+static wr_message_func_t						*wr_message_handlers[WR_MESSAGE_LAST];
 
-#define WR_MESSAGE_HANDLER(message, handler) \
-	wi_mutable_dictionary_set_data_for_key(wr_message_handlers, (handler), (message))
+static wi_p7_message_t							*wr_messages_message;
+static wr_message_id_t							wr_messages_message_id;
+
+wr_arena_t										*wr_messages_arena;
+
+#define WR_MESSAGE_NAME(message, id) \
+	wi_mutable_dictionary_set_data_for_key(wr_message_ids, (void *) (intptr_t) (id), (message))
+
+#define WR_MESSAGE_HANDLER(message, id, handler) \
+	WR_MESSAGE_NAME((message), (id)); wr_message_handlers[(id)] = (handler)
 	
 void wr_messages_init(void) {
-	wr_message_handlers = wi_dictionary_init_with_capacity_and_callbacks(wi_mutable_dictionary_alloc(),
+	wr_message_ids = wi_dictionary_init_with_capacity_and_callbacks(wi_mutable_dictionary_alloc(),
 		0, wi_dictionary_default_key_callbacks, wi_dictionary_null_value_callbacks);
 	
-	WR_MESSAGE_HANDLER(WI_STR("wired.okay"), wr_message_okay);
-	WR_MESSAGE_HANDLER(WI_STR("wired.error"), wr_message_error);
-	WR_MESSAGE_HANDLER(WI_STR("wired.server_info"), wr_message_server_info);
-	WR_MESSAGE_HANDLER(WI_STR("wired.send_ping"), wr_message_send_ping);
-	WR_MESSAGE_HANDLER(WI_STR("wired.ping"), wr_message_ping);
-	WR_MESSAGE_HANDLER(WI_STR("wired.user.info"), wr_message_user_info);
-	WR_MESSAGE_HANDLER(WI_STR("wired.chat.user_list"), wr_message_chat_user_list);
-	WR_MESSAGE_HANDLER(WI_STR("wired.chat.user_list.done"), wr_message_chat_user_list_done);
-	WR_MESSAGE_HANDLER(WI_STR("wired.chat.topic"), wr_message_chat_topic);
-	WR_MESSAGE_HANDLER(WI_STR("wired.chat.say"), wr_message_chat_say);
-	WR_MESSAGE_HANDLER(WI_STR("wired.chat.me"), wr_message_chat_me);
-	WR_MESSAGE_HANDLER(WI_STR("wired.chat.user_status"), wr_message_chat_user_status);
-	WR_MESSAGE_HANDLER(WI_STR("wired.chat.user_join"), wr_message_chat_user_join);
-	WR_MESSAGE_HANDLER(WI_STR("wired.chat.user_leave"), wr_message_chat_user_leave);
-	WR_MESSAGE_HANDLER(WI_STR("wired.chat.chat_created"), wr_message_chat_chat_created);
-	WR_MESSAGE_HANDLER(WI_STR("wired.chat.invitation"), wr_message_chat_invitation);
-	WR_MESSAGE_HANDLER(WI_STR("wired.chat.user_decline_invitation"), wr_message_chat_user_decline_invitation);
-	WR_MESSAGE_HANDLER(WI_STR("wired.message.message"), wr_message_message_message);
-	WR_MESSAGE_HANDLER(WI_STR("wired.message.broadcast"), wr_message_message_broadcast);
-    WR_MESSAGE_HANDLER(WI_STR("wired.file.file_list"), wr_message_file_list);
-    WR_MESSAGE_HANDLER(WI_STR("wired.file.file_list.done"), wr_message_file_list_done);
-	WR_MESSAGE_HANDLER(WI_STR("wired.file.directory_changed"), wr_message_file_directory_changed);
+	wr_messages_arena = wr_arena_create(WR_ARENA_CHUNK_SIZE);
+	
+	WR_MESSAGE_HANDLER(WI_STR("wired.okay"), WR_MESSAGE_OKAY, wr_message_okay);
+	WR_MESSAGE_HANDLER(WI_STR("wired.error"), WR_MESSAGE_ERROR, wr_message_error);
+	WR_MESSAGE_HANDLER(WI_STR("wired.server_info"), WR_MESSAGE_SERVER_INFO, wr_message_server_info);
+	WR_MESSAGE_HANDLER(WI_STR("wired.send_ping"), WR_MESSAGE_SEND_PING, wr_message_send_ping);
+	WR_MESSAGE_HANDLER(WI_STR("wired.ping"), WR_MESSAGE_PING, wr_message_ping);
+	WR_MESSAGE_HANDLER(WI_STR("wired.user.info"), WR_MESSAGE_USER_INFO, wr_message_user_info);
+	WR_MESSAGE_HANDLER(WI_STR("wired.chat.user_list"), WR_MESSAGE_CHAT_USER_LIST, wr_message_chat_user_list);
+	WR_MESSAGE_HANDLER(WI_STR("wired.chat.user_list.done"), WR_MESSAGE_CHAT_USER_LIST_DONE, wr_message_chat_user_list_done);
+	WR_MESSAGE_HANDLER(WI_STR("wired.chat.topic"), WR_MESSAGE_CHAT_TOPIC, wr_message_chat_topic);
+	WR_MESSAGE_HANDLER(WI_STR("wired.chat.say"), WR_MESSAGE_CHAT_SAY, wr_message_chat_say);
+	WR_MESSAGE_HANDLER(WI_STR("wired.chat.me"), WR_MESSAGE_CHAT_ME, wr_message_chat_me);
+	WR_MESSAGE_HANDLER(WI_STR("wired.chat.user_status"), WR_MESSAGE_CHAT_USER_STATUS, wr_message_chat_user_status);
+	WR_MESSAGE_HANDLER(WI_STR("wired.chat.user_join"), WR_MESSAGE_CHAT_USER_JOIN, wr_message_chat_user_join);
+	WR_MESSAGE_HANDLER(WI_STR("wired.chat.user_leave"), WR_MESSAGE_CHAT_USER_LEAVE, wr_message_chat_user_leave);
+	WR_MESSAGE_HANDLER(WI_STR("wired.chat.chat_created"), WR_MESSAGE_CHAT_CHAT_CREATED, wr_message_chat_chat_created);
+	WR_MESSAGE_HANDLER(WI_STR("wired.chat.invitation"), WR_MESSAGE_CHAT_INVITATION, wr_message_chat_invitation);
+	WR_MESSAGE_HANDLER(WI_STR("wired.chat.user_decline_invitation"), WR_MESSAGE_CHAT_USER_DECLINE_INVITATION, wr_message_chat_user_decline_invitation);
+	WR_MESSAGE_HANDLER(WI_STR("wired.message.message"), WR_MESSAGE_MESSAGE_MESSAGE, wr_message_message_message);
+	WR_MESSAGE_HANDLER(WI_STR("wired.message.broadcast"), WR_MESSAGE_MESSAGE_BROADCAST, wr_message_message_broadcast);
+	WR_MESSAGE_HANDLER(WI_STR("wired.file.file_list"), WR_MESSAGE_FILE_FILE_LIST, wr_message_file_list);
+	WR_MESSAGE_HANDLER(WI_STR("wired.file.file_list.done"), WR_MESSAGE_FILE_FILE_LIST_DONE, wr_message_file_list_done);
+	WR_MESSAGE_HANDLER(WI_STR("wired.file.directory_changed"), WR_MESSAGE_FILE_DIRECTORY_CHANGED, wr_message_file_directory_changed);
+	
+	// only ever sent, named here so outputs can refer to it
+	WR_MESSAGE_NAME(WI_STR("wired.board.add_thread"), WR_MESSAGE_BOARD_ADD_THREAD);
 }
 
 
 
 
 
-void wr_messages_handle_message(wi_p7_message_t *message) {
+wi_boolean_t wr_messages_handle_message(wi_p7_message_t *message) {
+	wi_pool_t				*pool;
 	wr_message_func_t		*handler;
-	wi_string_t				*name;
+	wr_message_id_t			id;
 	
-	name		= wi_p7_message_name(message);
-	handler		= wi_dictionary_data_for_key(wr_message_handlers, name);
+	id			= wr_messages_id_for_name(wi_p7_message_name(message));
+	handler		= wr_message_handlers[id];
 	
+	// nothing reads this message, so there is no point verifying it
 	if(!handler) {
-		wi_log_info(WI_STR("No handler for message \"%@\""), name);
+		wi_log_info(WI_STR("No handler for message \"%@\""), wi_p7_message_name(message));
 		
-		return;
+		return true;
 	}
 	
+	if(!wr_client_verify_message(wr_connection, message))
+		return false;
+	
+	// everything the handler autoreleases or puts in the arena is scratch
+	// for this message only, drop it before the next one comes in
+	pool = wi_pool_init(wi_pool_alloc());
+	
+	wr_messages_message		= message;
+	wr_messages_message_id	= id;
+	
 	(*handler)(message);
+	
+	wr_messages_message		= NULL;
+	wr_messages_message_id	= WR_MESSAGE_UNKNOWN;
+	
+	wr_arena_reset(wr_messages_arena);
+	wi_release(pool);
+	
+	return true;
+}
+
+
+
+wr_message_id_t wr_messages_id_for_name(wi_string_t *name) {
+	if(!name)
+		return WR_MESSAGE_UNKNOWN;
+	
+	return (wr_message_id_t) (intptr_t) wi_dictionary_data_for_key(wr_message_ids, name);
+}
+
+
+
+wr_message_id_t wr_messages_id_for_message(wi_p7_message_t *message) {
+	// the bot asks again for the message being dispatched, which is already resolved
+	if(message == wr_messages_message)
+		return wr_messages_message_id;
+	
+	return wr_messages_id_for_name(wi_p7_message_name(message));
 }
 
 
@@ -163,8 +221,11 @@ static void wr_message_okay(wi_p7_message_t *message) {
 
 
 static void wr_message_error(wi_p7_message_t *message) {
+	wi_enumerator_t			*enumerator;
+	wi_array_t				*watchers;
 	wi_string_t				*command;
-	wi_string_t				*string;
+	wi_string_t				*string, *path;
+	wb_watcher_t			*watcher;
 	wr_messages_error_t		error;
 	
 	wi_p7_message_get_enum_for_name(message, &error, WI_STR("wired.error"));
@@ -288,6 +349,25 @@ static void wr_message_error(wi_p7_message_t *message) {
 			break;
 	}
 	
+	// a listing the server refused gives its slot back, or arming would
+	// never finish
+	if(wr_connection == wr_connections_first() && wb_listings_note_error(message, &path) != WB_LISTING_NONE) {
+		wi_log_warn(WI_STR("Watcher: could not list %@: %@"), path, string);
+		
+		watchers = wb_bot ? wb_bot_watchers_for_path(wb_bot, path) : NULL;
+		
+		if(watchers) {
+			enumerator = wi_array_data_enumerator(watchers);
+			
+			while((watcher = wi_enumerator_next_data(enumerator)))
+				wb_watcher_files_abort(watcher, path);
+		}
+		
+		wb_snapshots_note_error(path);
+		
+		return;
+	}
+	
 	command = wr_commands_command_for_message(message);
 	
 	if(command)
@@ -309,14 +389,15 @@ static void wr_message_send_ping(wi_p7_message_t *message) {
 
 
 static void wr_message_ping(wi_p7_message_t *message) {
+	wr_client_ping_reply(message);
 }
 
 
 
 static void wr_message_server_info(wi_p7_message_t *message) {
-	wi_release(wr_server);
+	wi_release(wr_connection->server);
 	
-	wr_server = wr_server_init_with_message(wr_server_alloc(), message);
+	wr_connection->server = wr_server_init_with_message(wr_server_alloc(), message);
 }
 
 
@@ -384,12 +465,16 @@ static void wr_message_chat_user_list(wi_p7_message_t *message) {
 
 	chat = wr_chats_chat_with_cid(cid);
 
-	wr_chat_add_user(chat, wr_user_with_message(message));
+	if(chat)
+		wr_chat_add_listed_user(chat, wr_users_user_with_message(message));
 }
 
 
 
 static void wr_message_chat_user_list_done(wi_p7_message_t *message) {
+	wi_enumerator_t		*enumerator;
+	wi_array_t			*messages;
+	wi_p7_message_t		*deferred;
 	wr_chat_t			*chat;
 	wi_p7_uint32_t		cid;
 	
@@ -397,6 +482,28 @@ static void wr_message_chat_user_list_done(wi_p7_message_t *message) {
 
 	chat = wr_chats_chat_with_cid(cid);
 
+	if(!chat)
+		return;
+
+	wr_chat_finish_user_list(chat);
+
+	if(cid == WR_PUBLIC_CID) {
+		wr_connection->ready_time = wi_time_interval() - wr_connection->connect_time;
+
+		wi_log_info(WI_STR("%@: ready in %.3f seconds with %u users"),
+			wr_connection->name, wr_connection->ready_time, wi_array_count(wr_chat_users(chat)));
+	}
+
+	// rules held back while the list came in can see every user now
+	messages = wr_chat_take_deferred_messages(chat);
+
+	if(messages) {
+		enumerator = wi_array_data_enumerator(messages);
+
+		while((deferred = wi_enumerator_next_data(enumerator)))
+			wb_bot_dispatch_message(wb_bot, deferred);
+	}
+
 	//wr_draw_divider();
 	//wr_print_users(wr_windows_window_with_chat(chat));
 }
@@ -440,9 +547,12 @@ static void wr_message_chat_say(wi_p7_message_t *message) {
 	chat = wr_chats_chat_with_cid(cid);
 	user = wr_chat_user_with_uid(chat, uid);
 	
-	if(user) {
-		wb_bot_dispatch_message(wb_bot, message);
-	}
+	if(user)
+		wb_seen_note(wr_connection->hostname, wr_user_nick(user), WB_SEEN_SAY);
+	
+	// the bot defers it while the user list loads, and ignores it if the
+	// sender is still unknown after that
+	wb_bot_dispatch_message(wb_bot, message);
 }
 
 
@@ -459,9 +569,12 @@ static void wr_message_chat_me(wi_p7_message_t *message) {
 	chat = wr_chats_chat_with_cid(cid);
 	user = wr_chat_user_with_uid(chat, uid);
 	
-	if(user) {
-		wb_bot_dispatch_message(wb_bot, message);
-	}
+	if(user)
+		wb_seen_note(wr_connection->hostname, wr_user_nick(user), WB_SEEN_SAY);
+	
+	// the bot defers it while the user list loads, and ignores it if the
+	// sender is still unknown after that
+	wb_bot_dispatch_message(wb_bot, message);
 }
 
 
@@ -471,10 +584,11 @@ static void wr_message_chat_user_status(wi_p7_message_t *message) {
 	wr_user_t			*user;
 	wi_p7_uint32_t		uid;
 	wi_p7_boolean_t		idle, admin;
+	wi_boolean_t		changed;
 
 	wi_p7_message_get_uint32_for_name(message, &uid, WI_STR("wired.user.id"));
 	
-	user = wr_chat_user_with_uid(wr_public_chat, uid);
+	user = wr_chat_user_with_uid(wr_connection->public_chat, uid);
 
 	if(user) {
 		wi_p7_message_get_bool_for_name(message, &idle, WI_STR("wired.user.idle"));
@@ -483,16 +597,23 @@ static void wr_message_chat_user_status(wi_p7_message_t *message) {
 		nick		= wi_p7_message_string_for_name(message, WI_STR("wired.user.nick"));
 		status		= wi_p7_message_string_for_name(message, WI_STR("wired.user.status"));
 		
+		// going idle or coming back is sent as a status change too, but
+		// is not something the user did
+		changed		= (!wi_is_equal(wr_user_nick(user), nick) || !wi_is_equal(wr_user_status(user), status));
+		
 		if(!wi_is_equal(wr_user_nick(user), nick)) {
 			// wr_wprintf_prefix(wr_console_window, WI_STR("%@ is now known as %@"),
 			// 	wr_user_nick(user), nick);
 
-			wr_user_set_nick(user, nick);
+			wr_chats_rename_user(user, nick);
 		}
 
 		wr_user_set_idle(user, idle);
 		wr_user_set_admin(user, admin);
 		wr_user_set_status(user, status);
+
+		if(changed)
+			wb_seen_note(wr_connection->hostname, nick, WB_SEEN_STATUS);
 	}
 }
 
@@ -506,10 +627,13 @@ static void wr_message_chat_user_join(wi_p7_message_t *message) {
 	wi_p7_message_get_uint32_for_name(message, &cid, WI_STR("wired.chat.id"));
 	
 	chat = wr_chats_chat_with_cid(cid);
-	user = wr_user_with_message(message);
+	user = wr_users_user_with_message(message);
 
 	wr_chat_add_user(chat, user);
 
+	if(cid == WR_PUBLIC_CID)
+		wb_seen_note(wr_connection->hostname, wr_user_nick(user), WB_SEEN_JOIN);
+
 	wb_bot_dispatch_message(wb_bot, message);
 }
 
@@ -529,6 +653,12 @@ static void wr_message_chat_user_leave(wi_p7_message_t *message) {
 	if(user) {
 		wb_bot_dispatch_message(wb_bot, message);
 		wr_chat_remove_user(chat, user);
+
+		// every user is in the public chat, leaving it means leaving the server
+		if(cid == WR_PUBLIC_CID) {
+			wb_seen_note(wr_connection->hostname, wr_user_nick(user), WB_SEEN_LEAVE);
+			wr_users_remove_user(user);
+		}
 	}
 }
 
@@ -578,7 +708,7 @@ static void wr_message_chat_invitation(wi_p7_message_t *message) {
 	wi_p7_message_get_uint32_for_name(message, &cid, WI_STR("wired.chat.id"));
 	wi_p7_message_get_uint32_for_name(message, &uid, WI_STR("wired.user.id"));
 
-	user = wr_chat_user_with_uid(wr_public_chat, uid);
+	user = wr_chat_user_with_uid(wr_connection->public_chat, uid);
 	
 	if(user) {
 		chat = wr_chat_init_private_chat(wr_chat_alloc(), cid);
@@ -608,7 +738,7 @@ static void wr_message_chat_user_decline_invitation(wi_p7_message_t *message) {
 	wi_p7_message_get_uint32_for_name(message, &uid, WI_STR("wired.user.id"));
 
 	chat = wr_chats_chat_with_cid(cid);
-	user = wr_chat_user_with_uid(wr_public_chat, uid);
+	user = wr_chat_user_with_uid(wr_connection->public_chat, uid);
 	
 	if(chat && user) {
 		wi_log_info(WI_STR("%@ has declined invitation"),
@@ -619,91 +749,137 @@ static void wr_message_chat_user_decline_invitation(wi_p7_message_t *message) {
 
 
 static void wr_message_message_message(wi_p7_message_t *message) {
-	wr_user_t			*user;
-	wi_p7_uint32_t		uid;
+	// the sender is looked up by the bot, once the user list is loaded
+	wb_bot_dispatch_message(wb_bot, message);
+}
 
-	wi_p7_message_get_uint32_for_name(message, &uid, WI_STR("wired.user.id"));
 
-	user = wr_chat_user_with_uid(wr_public_chat, uid);
 
-	if(user ) {
-		wb_bot_dispatch_message(wb_bot, message);
-	}
+static void wr_message_message_broadcast(wi_p7_message_t *message) {
+	// the sender is looked up by the bot, once the user list is loaded
+	wb_bot_dispatch_message(wb_bot, message);
 }
 
 
 
-static void wr_message_message_broadcast(wi_p7_message_t *message) {
-	wr_user_t			*user;
-	wi_p7_uint32_t		uid;
+static void wr_message_file_list(wi_p7_message_t *message) {
+	wi_enumerator_t			*enumerator;
+	wi_array_t				*watchers;
+    wi_string_t 			*path, *directory;
+	wi_date_t				*date;
+	wi_time_interval_t		mtime;
+    wb_watcher_t 			*watcher;
+	wb_snapshot_change_t	change;
+	wb_listing_kind_t		kind;
+	wi_p7_uint64_t			size;
+	wi_p7_enum_t			type;
+	wi_boolean_t			directory_found;
 
-	wi_p7_message_get_uint32_for_name(message, &uid, WI_STR("wired.user.id"));
+    path 				= wi_p7_message_string_for_name(message, WI_STR("wired.file.path"));
+    directory	 		= wi_string_by_deleting_last_path_component(path);
+	watchers			= wb_bot_watchers_for_path(wb_bot, directory);
 
-	user = wr_chat_user_with_uid(wr_public_chat, uid);
+	if(wi_array_count(watchers) == 0)
+		return;
 
-	if(user) {
-		 wb_bot_dispatch_message(wb_bot, message);
-	}
-}
+	// only listings we asked for feed the watchers
+	kind = wb_listings_kind_for_message(message, directory);
 
+	if(kind == WB_LISTING_NONE)
+		return;
 
+	size				= 0;
+	type				= WR_FILE_FILE;
+	directory_found		= false;
+	date				= wi_p7_message_date_for_name(message, WI_STR("wired.file.modification_time"));
 
-static void wr_message_file_list(wi_p7_message_t *message) {
-    wr_chat_t			*chat;
-    wi_string_t 		*path, *watcher_path;
-    wb_watcher_t 		*watcher;
+	wi_p7_message_get_uint64_for_name(message, &size, WI_STR("wired.file.data_size"));
+	wi_p7_message_get_enum_for_name(message, &type, WI_STR("wired.file.type"));
 
-    path 				= wi_p7_message_string_for_name(message, WI_STR("wired.file.path"));
-    watcher_path 		= wi_string_by_deleting_last_path_component(path);
-	watcher 			= wb_bot_watcher_for_path(wb_bot, watcher_path);
+	mtime		= date ? wi_date_time_interval(date) : 0.0;
+	change		= wb_snapshots_note_file(directory, path, size, mtime);
+	enumerator	= wi_array_data_enumerator(watchers);
 
-	if(watcher && wb_watcher_activated(watcher)) {
-	    if(wb_bot_is_subscribing(wb_bot)) {
-			wb_watcher_add_file(watcher, path);
+	while((watcher = wi_enumerator_next_data(enumerator))) {
+	    if(kind == WB_LISTING_INITIAL) {
+			// the initial listing is compared with the last snapshot, so
+			// files that came in while we were away are still announced
+			wb_watcher_add_file(watcher, path, directory, size, mtime, type, (change == WB_SNAPSHOT_ADDED));
+
+			if(change == WB_SNAPSHOT_MODIFIED)
+				wi_log_info(WI_STR("Watcher File Modified: %@"), path);
 	    }
 	    else {
-	    	wb_watcher_add_new_file(watcher, path);
+	    	wb_watcher_add_file(watcher, path, directory, size, mtime, type, true);
+	    }
+
+	    // drop boxes cannot be listed
+	    if(type == WR_FILE_DIRECTORY || type == WR_FILE_UPLOADS) {
+	    	if(wb_watcher_add_directory(watcher, path))
+	    		directory_found = true;
 	    }
 	}
+
+	// recursive watchers walk down their tree through the listing queue,
+	// a directory that appears later is listed as new so its files are
+	// announced
+	if(directory_found)
+		wb_listings_queue(path, kind, true);
 }
 
 
 
 static void wr_message_file_list_done(wi_p7_message_t *message) {
+	wi_enumerator_t		*enumerator;
+	wi_mutable_array_t	*held;
+	wi_array_t			*watchers, *pending;
 	wi_string_t 		*path;
 	wb_watcher_t 		*watcher;
+	wb_listing_kind_t	kind;
+	wi_integer_t		removed;
 
 	path		= wi_p7_message_string_for_name(message, WI_STR("wired.file.path"));
-	watcher 	= wb_bot_watcher_for_path(wb_bot, path);
+	watchers	= wb_bot_watchers_for_path(wb_bot, path);
 
-	if(watcher && wb_watcher_activated(watcher)) {
-	    if(wb_bot_is_subscribing(wb_bot)) {
-    		
-	    }
-	    else {
-	    	wb_watcher_files_diff(watcher);
-	    }
+	// changes that came in meanwhile are listed again after this
+	kind		= wb_listings_note_done(message, path);
+
+	if(kind == WB_LISTING_NONE || wi_array_count(watchers) == 0)
+		return;
+
+	held		= wi_mutable_array();
+	enumerator 	= wi_array_data_enumerator(watchers);
+
+	while((watcher = wi_enumerator_next_data(enumerator))) {
+	    wb_watcher_files_diff(watcher, path);
+
+	    if(kind == WB_LISTING_INITIAL && wi_is_equal(wb_watcher_path(watcher), path))
+	    	wb_watcher_set_armed(watcher, true);
+
+	    // files still settling are not announced yet, they stay out of
+	    // the snapshot until they are
+	    pending = wb_watcher_pending_files(watcher, path);
+
+	    if(pending)
+	    	wi_mutable_array_add_data_from_array(held, pending);
 	}
+
+	removed = wb_snapshots_note_done(path, held);
+
+	if(removed > 0 && kind == WB_LISTING_INITIAL)
+		wi_log_info(WI_STR("Watcher: %d files removed from %@ since the last snapshot"), removed, path);
 }
 
 
 static void wr_message_file_directory_changed(wi_p7_message_t *message) {
 	wi_string_t 		*path;
-	wb_watcher_t 		*watcher;
-
-	// this is a like hacky...
-	wb_bot_set_subscribing(wb_bot, false);
 
 	path		= wi_p7_message_string_for_name(message, WI_STR("wired.file.path"));
-	watcher 	= wb_bot_watcher_for_path(wb_bot, path);
 
-	if(watcher && wb_watcher_activated(watcher)) {
-		message = wi_p7_message_with_name(WI_STR("wired.file.list_directory"), wr_p7_spec);
-		wi_p7_message_set_string_for_name(message, path, WI_STR("wired.file.path"));
-
-		if(wr_connected)
-	    	wr_client_send_message(message);
-	}
+	// one listing serves every watcher interested in the directory, and
+	// bursts of changes are coalesced before it is sent
+	if(wi_array_count(wb_bot_watchers_for_path(wb_bot, path)) > 0)
+		wb_listings_note_change(path);
 }
 
 
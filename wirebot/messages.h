@@ -29,7 +29,52 @@
 #ifndef WR_MESSAGES_H
 #define WR_MESSAGES_H 1
 
+#include <wired/wired.h>
+
+#include "arena.h"
+
+/**
+ * Messages known to the client, resolved once from
+ * their name so that dispatch and the bot engine can
+ * switch on an integer instead of comparing strings
+ */
+enum _wr_message_id {
+	WR_MESSAGE_UNKNOWN							= 0,
+	WR_MESSAGE_OKAY,
+	WR_MESSAGE_ERROR,
+	WR_MESSAGE_SERVER_INFO,
+	WR_MESSAGE_SEND_PING,
+	WR_MESSAGE_PING,
+	WR_MESSAGE_USER_INFO,
+	WR_MESSAGE_CHAT_USER_LIST,
+	WR_MESSAGE_CHAT_USER_LIST_DONE,
+	WR_MESSAGE_CHAT_TOPIC,
+	WR_MESSAGE_CHAT_SAY,
+	WR_MESSAGE_CHAT_ME,
+	WR_MESSAGE_CHAT_USER_STATUS,
+	WR_MESSAGE_CHAT_USER_JOIN,
+	WR_MESSAGE_CHAT_USER_LEAVE,
+	WR_MESSAGE_CHAT_CHAT_CREATED,
+	WR_MESSAGE_CHAT_INVITATION,
+	WR_MESSAGE_CHAT_USER_DECLINE_INVITATION,
+	WR_MESSAGE_MESSAGE_MESSAGE,
+	WR_MESSAGE_MESSAGE_BROADCAST,
+	WR_MESSAGE_FILE_FILE_LIST,
+	WR_MESSAGE_FILE_FILE_LIST_DONE,
+	WR_MESSAGE_FILE_DIRECTORY_CHANGED,
+	WR_MESSAGE_BOARD_ADD_THREAD,
+	
+	WR_MESSAGE_LAST
+};
+typedef enum _wr_message_id				wr_message_id_t;
+
+
 void					wr_messages_init(void);
-void					wr_messages_handle_message(wi_p7_message_t *);
+wi_boolean_t			wr_messages_handle_message(wi_p7_message_t *);
+
+wr_message_id_t			wr_messages_id_for_name(wi_string_t *);
+wr_message_id_t			wr_messages_id_for_message(wi_p7_message_t *);
+
+extern wr_arena_t		*wr_messages_arena;
 
 #endif /* WR_MESSAGES_H */
@@ -52,6 +52,7 @@
 	wi_runtime_base_t				base;
 
 	wi_string_t						*message_name;
+	wr_message_id_t					message_id;
 	wi_string_t						*input_text;
 	wi_string_t						*output;
 	wi_string_t 					*board;
@@ -107,6 +108,7 @@ wb_output_t * wb_output_init(wb_output_t *output, xmlNodePtr node) {
 
 wb_output_t * wb_output_init_with_message_name(wb_output_t *output, wi_string_t *name) {
 	output->message_name 	= wi_retain(name);
+	output->message_id		= wr_messages_id_for_name(name);
 
 	return output;
 }
@@ -117,27 +119,11 @@ wb_output_t * wb_output_init_with_message_name(wb_output_t *output, wi_string_t
 
 #pragma mark -
 
-wi_string_t * wb_output_wire_command_string(wb_output_t *output, wr_user_t *user) {
-	wi_string_t 	* result, *nick, *string;
+wi_string_t * wb_output_text(wb_output_t *output, wr_user_t *user) {
+	wi_string_t 	*nick, *string;
 
 	nick 			= wr_user_nick(user);
-
-	if(wi_is_equal(wb_output_message_name(output), WI_STR("wired.chat.say"))) {
-		string = wi_string_with_format(WI_STR("%@"), wb_output_output(output));
-
-	} else if(wi_is_equal(wb_output_message_name(output), WI_STR("wired.chat.me"))) {
-		string = wi_string_with_format(WI_STR("/me %@"), wb_output_output(output));
-
-	} else if(wi_is_equal(wb_output_message_name(output), WI_STR("wired.message.message"))) {
-		string = wi_string_with_format(WI_STR("/msg %@ %@"), nick, wb_output_output(output));
-
-	} else if(wi_is_equal(wb_output_message_name(output), WI_STR("wired.message.broadcast"))) {
-		string = wi_string_with_format(WI_STR("/broadcast %@"), wb_output_output(output));
-
-	} else {
-		string = wi_string_with_format(WI_STR("%@"), wb_output_output(output));
-
-	}
+	string			= wb_output_output(output);
 
 	string = wi_string_by_replacing_string_with_string(string, WB_BOT_NICK, wr_nick, WI_STRING_SMART_CASE_INSENSITIVE);
 	string = wi_string_by_replacing_string_with_string(string, WB_INPUT_NICK, nick, WI_STRING_SMART_CASE_INSENSITIVE);
@@ -149,14 +135,30 @@ wi_string_t * wb_output_wire_command_string(wb_output_t *output, wr_user_t *user
 }
 
 
-wi_boolean_t wb_output_is_chat(wb_output_t *output) {
-	if(wi_is_equal(wb_output_message_name(output), WI_STR("wired.chat.say")))
-		return true;
 
-	if(wi_is_equal(wb_output_message_name(output), WI_STR("wired.chat.me")))
-		return true;
+wi_string_t * wb_output_wire_command_string(wb_output_t *output, wr_user_t *user) {
+	wi_string_t 	*text;
+
+	text			= wb_output_text(output, user);
 
-	return false;
+	switch(output->message_id) {
+		case WR_MESSAGE_CHAT_ME:
+			return wi_string_with_format(WI_STR("/me %@"), text);
+
+		case WR_MESSAGE_MESSAGE_MESSAGE:
+			return wi_string_with_format(WI_STR("/msg %@ %@"), wr_user_nick(user), text);
+
+		case WR_MESSAGE_MESSAGE_BROADCAST:
+			return wi_string_with_format(WI_STR("/broadcast %@"), text);
+
+		default:
+			return text;
+	}
+}
+
+
+wi_boolean_t wb_output_is_chat(wb_output_t *output) {
+	return (output->message_id == WR_MESSAGE_CHAT_SAY || output->message_id == WR_MESSAGE_CHAT_ME);
 }
 
 
@@ -167,11 +169,16 @@ wi_string_t * wb_output_message_name(wb_output_t *output) {
 	return output->message_name;
 }
 
+wr_message_id_t wb_output_message_id(wb_output_t *output) {
+	return output->message_id;
+}
+
 void wb_output_set_message_name(wb_output_t *output, wi_string_t *string) {
 	if(output->message_name)
 		wi_release(output->message_name);
 
 	output->message_name = wi_retain(string);
+	output->message_id	 = wr_messages_id_for_name(string);
 }
 
 
@@ -35,6 +35,7 @@
 #include <libxml/xpath.h>
 #include <wired/wired.h>
 
+#include "messages.h"
 #include "users.h"
 
 
@@ -64,10 +65,12 @@ wb_output_t * 					wb_output_alloc(void);
 wb_output_t *					wb_output_init(wb_output_t *, xmlNodePtr);
 wb_output_t *					wb_output_init_with_message_name(wb_output_t *, wi_string_t *);
 
+wi_string_t *					wb_output_text(wb_output_t *, wr_user_t *);
 wi_string_t *					wb_output_wire_command_string(wb_output_t *, wr_user_t *);
 wi_boolean_t					wb_output_is_chat(wb_output_t *);
 
 wi_string_t *					wb_output_message_name(wb_output_t *);
+wr_message_id_t					wb_output_message_id(wb_output_t *);
 void							wb_output_set_message_name(wb_output_t *, wi_string_t *);
 
 wi_string_t * 					wb_output_input_text(wb_output_t *);
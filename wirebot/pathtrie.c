@@ -0,0 +1,251 @@
+/* $Id$ */
+
+/*
+ *  Copyright (c) 2012 Rafael Warnault
+ *  All rights reserved.
+ * 
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "config.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <wired/wired.h>
+
+#include "pathtrie.h"
+
+/*
+	A trie of remote paths, one node per path component, used to find every
+	watcher interested in a directory with a single walk. Data is registered
+	either for a path only, or recursively for the path and everything below
+	it. Looking up a path returns the data registered at that exact path plus
+	the recursive data of every node passed on the way down.
+	
+	Components are compared as C strings so a lookup allocates nothing but
+	the result array. Siblings are kept in a plain list, watched trees are
+	narrow and this keeps nodes small.
+*/
+
+struct _wr_pathtrie_node {
+	char							*component;
+	size_t							length;
+	
+	struct _wr_pathtrie_node		*children;
+	struct _wr_pathtrie_node		*next;
+	
+	wi_mutable_array_t				*data;
+	wi_mutable_array_t				*recursive_data;
+};
+typedef struct _wr_pathtrie_node	wr_pathtrie_node_t;
+
+struct _wr_pathtrie {
+	wr_pathtrie_node_t				*root;
+	wi_uinteger_t					count;
+};
+
+
+static wr_pathtrie_node_t *			wr_pathtrie_node_create(const char *, size_t);
+static void							wr_pathtrie_node_destroy(wr_pathtrie_node_t *);
+static wr_pathtrie_node_t *			wr_pathtrie_node_child(wr_pathtrie_node_t *, const char *, size_t);
+static const char *					wr_pathtrie_next_component(const char *, size_t *);
+
+
+
+wr_pathtrie_t * wr_pathtrie_create(void) {
+	wr_pathtrie_t		*trie;
+	
+	trie			= wi_malloc(sizeof(wr_pathtrie_t));
+	trie->root		= wr_pathtrie_node_create("", 0);
+	trie->count		= 0;
+	
+	return trie;
+}
+
+
+
+void wr_pathtrie_destroy(wr_pathtrie_t *trie) {
+	if(!trie)
+		return;
+	
+	wr_pathtrie_node_destroy(trie->root);
+	
+	wi_free(trie);
+}
+
+
+
+#pragma mark -
+
+void wr_pathtrie_add_data_for_path(wr_pathtrie_t *trie, void *data, wi_string_t *path, wi_boolean_t recursive) {
+	wr_pathtrie_node_t	*node, *child;
+	const char			*component;
+	size_t				length;
+	
+	node		= trie->root;
+	component	= wi_string_cstring(path);
+	
+	while((component = wr_pathtrie_next_component(component, &length))) {
+		child = wr_pathtrie_node_child(node, component, length);
+		
+		if(!child) {
+			child			= wr_pathtrie_node_create(component, length);
+			child->next		= node->children;
+			node->children	= child;
+		}
+		
+		node		= child;
+		component	+= length;
+	}
+	
+	if(recursive) {
+		if(!node->recursive_data)
+			node->recursive_data = wi_array_init(wi_mutable_array_alloc());
+		
+		wi_mutable_array_add_data(node->recursive_data, data);
+	} else {
+		if(!node->data)
+			node->data = wi_array_init(wi_mutable_array_alloc());
+		
+		wi_mutable_array_add_data(node->data, data);
+	}
+	
+	trie->count++;
+}
+
+
+
+void wr_pathtrie_remove_all_data(wr_pathtrie_t *trie) {
+	wr_pathtrie_node_destroy(trie->root);
+	
+	trie->root	= wr_pathtrie_node_create("", 0);
+	trie->count	= 0;
+}
+
+
+
+#pragma mark -
+
+wi_array_t * wr_pathtrie_data_for_path(wr_pathtrie_t *trie, wi_string_t *path) {
+	wi_mutable_array_t	*array;
+	wr_pathtrie_node_t	*node;
+	const char			*component;
+	size_t				length;
+	
+	array		= wi_mutable_array();
+	node		= trie->root;
+	component	= wi_string_cstring(path);
+	
+	while(node) {
+		if(node->recursive_data)
+			wi_mutable_array_add_data_from_array(array, node->recursive_data);
+		
+		component = wr_pathtrie_next_component(component, &length);
+		
+		if(!component) {
+			if(node->data)
+				wi_mutable_array_add_data_from_array(array, node->data);
+			
+			break;
+		}
+		
+		node		= wr_pathtrie_node_child(node, component, length);
+		component	+= length;
+	}
+	
+	return array;
+}
+
+
+
+wi_uinteger_t wr_pathtrie_count(wr_pathtrie_t *trie) {
+	return trie->count;
+}
+
+
+
+#pragma mark -
+
+static wr_pathtrie_node_t * wr_pathtrie_node_create(const char *component, size_t length) {
+	wr_pathtrie_node_t		*node;
+	
+	node				= wi_malloc(sizeof(wr_pathtrie_node_t));
+	
+	memset(node, 0, sizeof(wr_pathtrie_node_t));
+	
+	node->component		= wi_malloc(length + 1);
+	node->length		= length;
+	
+	memcpy(node->component, component, length);
+	node->component[length] = '\0';
+	
+	return node;
+}
+
+
+
+static void wr_pathtrie_node_destroy(wr_pathtrie_node_t *node) {
+	wr_pathtrie_node_t		*child, *next;
+	
+	for(child = node->children; child; child = next) {
+		next = child->next;
+		
+		wr_pathtrie_node_destroy(child);
+	}
+	
+	wi_release(node->data);
+	wi_release(node->recursive_data);
+	
+	wi_free(node->component);
+	wi_free(node);
+}
+
+
+
+static wr_pathtrie_node_t * wr_pathtrie_node_child(wr_pathtrie_node_t *node, const char *component, size_t length) {
+	wr_pathtrie_node_t		*child;
+	
+	for(child = node->children; child; child = child->next) {
+		if(child->length == length && memcmp(child->component, component, length) == 0)
+			return child;
+	}
+	
+	return NULL;
+}
+
+
+
+static const char * wr_pathtrie_next_component(const char *string, size_t *length) {
+	const char				*end;
+	
+	// skip separators, so "/a//b/" and "a/b" walk the same nodes
+	while(*string == '/')
+		string++;
+	
+	if(*string == '\0')
+		return NULL;
+	
+	end = strchr(string, '/');
+	*length = end ? (size_t) (end - string) : strlen(string);
+	
+	return string;
+}
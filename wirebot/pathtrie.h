@@ -0,0 +1,46 @@
+/* $Id$ */
+
+/*
+ *  Copyright (c) 2012 Rafael Warnault
+ *  All rights reserved.
+ * 
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef WR_PATHTRIE_H
+#define WR_PATHTRIE_H 1
+
+#include <wired/wired.h>
+
+typedef struct _wr_pathtrie				wr_pathtrie_t;
+
+
+wr_pathtrie_t *							wr_pathtrie_create(void);
+void									wr_pathtrie_destroy(wr_pathtrie_t *);
+
+void									wr_pathtrie_add_data_for_path(wr_pathtrie_t *, void *, wi_string_t *, wi_boolean_t);
+void									wr_pathtrie_remove_all_data(wr_pathtrie_t *);
+
+wi_array_t *							wr_pathtrie_data_for_path(wr_pathtrie_t *, wi_string_t *);
+wi_uinteger_t							wr_pathtrie_count(wr_pathtrie_t *);
+
+#endif /* WR_PATHTRIE_H */
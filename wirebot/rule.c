@@ -37,6 +37,8 @@ struct _wb_rule {
 
 	wi_boolean_t					activated;
 	wi_string_t 					*permissions;
+	wb_rule_chats_t					chats;
+	wi_mutable_array_t				*chat_ids;
 	wi_mutable_array_t				*inputs;
 	wi_mutable_array_t				*outputs;
 };  
@@ -84,6 +86,8 @@ wb_rule_t * wb_rule_alloc(void) {
 	
 	rule->permissions 	= wi_retain(WI_STR("any"));
 	rule->activated 	= true;
+	rule->chats 		= WB_RULE_CHATS_ALL;
+	rule->chat_ids 		= wi_array_init(wi_mutable_array_alloc());
 	rule->inputs 		= wi_array_init(wi_mutable_array_alloc());
 	rule->outputs 		= wi_array_init(wi_mutable_array_alloc());
 
@@ -102,6 +106,14 @@ wi_string_t * wb_rule_permissions(wb_rule_t *rule) {
 	return rule->permissions;
 }
 
+wb_rule_chats_t wb_rule_chats(wb_rule_t *rule) {
+	return rule->chats;
+}
+
+wi_array_t * wb_rule_chat_ids(wb_rule_t *rule) {
+	return rule->chat_ids;
+}
+
 wi_mutable_array_t * wb_rule_inputs(wb_rule_t *rule) {
 	return rule->inputs;
 }
@@ -117,7 +129,8 @@ wi_mutable_array_t * wb_rule_outputs(wb_rule_t *rule) {
 #pragma mark -
 
 static wb_rule_t * _wb_rule_load_with_node(wb_rule_t *rule, xmlNodePtr node) {
-	wi_string_t 			*permissions, *activated;
+	wi_enumerator_t			*enumerator;
+	wi_string_t 			*permissions, *activated, *chats, *chat;
 	wb_input_t 				*input;
 	wb_output_t 			*output;
 	xmlNodePtr				sub_node, next_node;
@@ -132,6 +145,28 @@ static wb_rule_t * _wb_rule_load_with_node(wb_rule_t *rule, xmlNodePtr node) {
 	if(activated)
 		rule->activated = wi_is_equal(activated, WI_STR("true")) ? true : false;
 
+	// get rule chats: "public", "private" or chat ids, comma separated
+	chats = wi_xml_node_attribute_with_name(node, WI_STR("chats"));
+	if(chats) {
+		rule->chats = WB_RULE_CHATS_NONE;
+		enumerator 	= wi_array_data_enumerator(wi_string_components_separated_by_string(chats, WI_STR(",")));
+
+		while((chat = wi_enumerator_next_data(enumerator))) {
+			chat = wi_string_by_deleting_surrounding_whitespace(chat);
+
+			if(wi_is_equal(chat, WI_STR("public")))
+				rule->chats |= WB_RULE_CHATS_PUBLIC;
+			else if(wi_is_equal(chat, WI_STR("private")))
+				rule->chats |= WB_RULE_CHATS_PRIVATE;
+			else if(wi_is_equal(chat, WI_STR("any")))
+				rule->chats |= WB_RULE_CHATS_ALL;
+			else if(wi_string_uint32(chat) > 0)
+				wi_mutable_array_add_data(rule->chat_ids, wi_number_with_integer(wi_string_uint32(chat)));
+			else
+				wi_log_warn(WI_STR("Unknown chat \"%@\" in rule, ignoring"), chat);
+		}
+	}
+
 	// get rule children: inputs and outputs 
 	for(sub_node = node->children; sub_node != NULL; sub_node = next_node) {
 		next_node = sub_node->next;
@@ -163,6 +198,7 @@ static void wb_rule_dealloc(wi_runtime_instance_t *instance) {
 	wb_rule_t		*rule = instance;
 
 	wi_release(rule->permissions);
+	wi_release(rule->chat_ids);
 	wi_release(rule->inputs);
 	wi_release(rule->outputs);
 }
@@ -38,6 +38,19 @@
 #include <wired/wired.h>
 
 
+/**
+ * Chats a rule listens to, set with the
+ * "chats" attribute of the rule
+ */
+enum _wb_rule_chats {
+	WB_RULE_CHATS_NONE			= 0,
+	WB_RULE_CHATS_PUBLIC		= (1 << 0),
+	WB_RULE_CHATS_PRIVATE		= (1 << 1),
+	WB_RULE_CHATS_ALL			= (WB_RULE_CHATS_PUBLIC | WB_RULE_CHATS_PRIVATE)
+};
+typedef enum _wb_rule_chats			wb_rule_chats_t;
+
+
 typedef struct _wb_rule				wb_rule_t;
 
 void 								wb_rules_init(void);
@@ -47,6 +60,8 @@ wb_rule_t *							wb_rule_init(wb_rule_t *, xmlNodePtr);
 
 wi_boolean_t						wb_rule_is_activated(wb_rule_t *);
 wi_string_t *						wb_rule_permissions(wb_rule_t *);
+wb_rule_chats_t						wb_rule_chats(wb_rule_t *);
+wi_array_t *						wb_rule_chat_ids(wb_rule_t *);
 wi_mutable_array_t * 				wb_rule_inputs(wb_rule_t *);
 wi_mutable_array_t * 				wb_rule_outputs(wb_rule_t *);
 
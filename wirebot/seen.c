@@ -0,0 +1,655 @@
+/* $Id$ */
+
+/*
+ *  Copyright (c) 2012 Rafael Warnault
+ *  All rights reserved.
+ * 
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "config.h"
+
+#include <sys/types.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <ctype.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <strings.h>
+#include <unistd.h>
+#include <wired/wired.h>
+
+#include "seen.h"
+
+/*
+	The seen database is a file holding an open addressing hash table of
+	fixed size slots, mapped with mmap. Nothing is loaded at startup and
+	lookups and updates touch a single slot, so it serves millions of
+	nicks out of the page cache without using any heap.
+	
+	Nicks are kept per server, told apart by a hash of the host name in
+	each slot. Slots carried over from the first version of the file have
+	no server and answer for every server until the nick is seen again.
+	The file is locked while it is mapped, so a second wirebot pointed at
+	it refuses to use it rather than corrupting it.
+	
+	Updates are ordered so that a crash never leaves a half written slot
+	visible: a new slot gets its nick and stamp first and its key last,
+	and an existing slot is updated with one aligned 64-bit store. Growing
+	the table writes a complete new file next to the old one and renames it
+	over it, so either the old or the new table survives.
+*/
+
+#define WB_SEEN_MAGIC					"WBSEEN02"
+#define WB_SEEN_LEGACY_MAGIC			"WBSEEN01"
+#define WB_SEEN_INITIAL_CAPACITY		4096
+#define WB_SEEN_NICK_SIZE				43
+#define WB_SEEN_LEGACY_NICK_SIZE		47
+
+struct _wb_seen_header {
+	char							magic[8];
+	uint32_t						slot_size;
+	uint32_t						reserved;
+	uint64_t						capacity;
+	uint64_t						count;
+	char							padding[32];
+};
+typedef struct _wb_seen_header		wb_seen_header_t;
+
+struct _wb_seen_slot {
+	uint64_t						key;
+	uint64_t						stamp;
+	uint32_t						server;
+	uint8_t							length;
+	char							nick[WB_SEEN_NICK_SIZE];
+};
+typedef struct _wb_seen_slot		wb_seen_slot_t;
+
+struct _wb_seen_legacy_slot {
+	uint64_t						key;
+	uint64_t						stamp;
+	uint8_t							length;
+	char							nick[WB_SEEN_LEGACY_NICK_SIZE];
+};
+typedef struct _wb_seen_legacy_slot	wb_seen_legacy_slot_t;
+
+struct _wb_seen_table {
+	int								fd;
+	size_t							size;
+	wb_seen_header_t				*header;
+	wb_seen_slot_t					*slots;
+};
+typedef struct _wb_seen_table		wb_seen_table_t;
+
+enum _wb_seen_map_result {
+	WB_SEEN_MAPPED					= 0,
+	WB_SEEN_LOCKED,
+	WB_SEEN_CORRUPT,
+	WB_SEEN_FAILED
+};
+typedef enum _wb_seen_map_result	wb_seen_map_result_t;
+
+
+static wb_seen_map_result_t			wb_seen_map(wb_seen_table_t *, const char *, uint64_t);
+static void							wb_seen_unmap(wb_seen_table_t *);
+static wi_boolean_t					wb_seen_upgrade(wi_string_t *);
+static wi_boolean_t					wb_seen_grow(void);
+static wb_seen_slot_t *				wb_seen_find_slot(uint32_t, const char *, size_t);
+static wb_seen_slot_t *				wb_seen_slot(wb_seen_table_t *, uint64_t, uint32_t, const char *, size_t);
+static uint64_t						wb_seen_key(uint32_t, const char *, size_t);
+static uint32_t						wb_seen_server(wi_string_t *);
+
+
+static wb_seen_table_t				wb_seen_table = { -1, 0, NULL, NULL };
+static wi_string_t					*wb_seen_path;
+
+
+
+#pragma mark -
+
+wi_boolean_t wb_seen_open(wi_string_t *path) {
+	wi_string_t				*bad_path;
+	wb_seen_map_result_t	result;
+	
+	wb_seen_close();
+	
+	wb_seen_path = wi_retain(path);
+	
+	if(!wb_seen_upgrade(path))
+		return false;
+	
+	result = wb_seen_map(&wb_seen_table, wi_string_cstring(path), 0);
+	
+	if(result == WB_SEEN_MAPPED)
+		return true;
+	
+	if(result == WB_SEEN_LOCKED) {
+		wi_log_error(WI_STR("Could not open seen database %@: it is in use by another process"), path);
+		
+		return false;
+	}
+	
+	// only a file that is not a seen table is moved aside, a file that
+	// could not be read is left alone for the next start
+	if(result == WB_SEEN_CORRUPT) {
+		bad_path = wi_string_by_appending_string(path, WI_STR(".bad"));
+		
+		wi_log_warn(WI_STR("Could not use seen database %@, moving it to %@"), path, bad_path);
+		
+		if(rename(wi_string_cstring(path), wi_string_cstring(bad_path)) < 0) {
+			wi_log_error(WI_STR("Could not move seen database %@: %m"), path);
+			
+			return false;
+		}
+		
+		result = wb_seen_map(&wb_seen_table, wi_string_cstring(path), 0);
+		
+		if(result == WB_SEEN_MAPPED)
+			return true;
+	}
+	
+	if(result == WB_SEEN_FAILED)
+		wi_log_error(WI_STR("Could not open seen database %@: %m"), path);
+	else
+		wi_log_error(WI_STR("Could not open seen database %@"), path);
+	
+	return false;
+}
+
+
+
+void wb_seen_close(void) {
+	wb_seen_unmap(&wb_seen_table);
+	
+	wi_release(wb_seen_path);
+	wb_seen_path = NULL;
+}
+
+
+
+#pragma mark -
+
+void wb_seen_note(wi_string_t *server, wi_string_t *nick, wb_seen_event_t event) {
+	wb_seen_slot_t		*slot;
+	const char			*cnick;
+	size_t				length;
+	uint64_t			key, stamp;
+	uint32_t			server_key;
+	
+	if(!wb_seen_table.header || !nick)
+		return;
+	
+	cnick	= wi_string_cstring(nick);
+	length	= strlen(cnick);
+
+	// longer nicks are stored truncated, the key still covers the stored part
+	if(length > WB_SEEN_NICK_SIZE)
+		length = WB_SEEN_NICK_SIZE;
+	
+	if(length == 0)
+		return;
+	
+	server_key	= wb_seen_server(server);
+	key			= wb_seen_key(server_key, cnick, length);
+	stamp		= ((uint64_t) wi_time_interval() << 8) | (event & 0xff);
+	slot		= wb_seen_slot(&wb_seen_table, key, server_key, cnick, length);
+	
+	if(slot->key == 0) {
+		// stay under 70% full so probe chains remain short
+		if((wb_seen_table.header->count + 1) * 10 > wb_seen_table.header->capacity * 7) {
+			if(!wb_seen_grow())
+				return;
+			
+			slot = wb_seen_slot(&wb_seen_table, key, server_key, cnick, length);
+		}
+		
+		memcpy(slot->nick, cnick, length);
+		slot->server	= server_key;
+		slot->length	= length;
+		slot->stamp		= stamp;
+		
+		// the slot only becomes visible once everything else is in place
+		__sync_synchronize();
+		
+		slot->key		= key;
+		
+		wb_seen_table.header->count++;
+	} else {
+		// keep the latest spelling of the nick for replies
+		memcpy(slot->nick, cnick, length);
+		
+		__sync_synchronize();
+		
+		slot->stamp		= stamp;
+	}
+}
+
+
+
+wi_boolean_t wb_seen_lookup(wi_string_t *server, wi_string_t *nick, wi_time_interval_t *time, wb_seen_event_t *event) {
+	wb_seen_slot_t		*slot;
+	const char			*cnick;
+	size_t				length;
+	uint64_t			stamp;
+	
+	if(!wb_seen_table.header || !nick)
+		return false;
+	
+	cnick	= wi_string_cstring(nick);
+	length	= strlen(cnick);
+
+	if(length > WB_SEEN_NICK_SIZE)
+		length = WB_SEEN_NICK_SIZE;
+	
+	if(length == 0)
+		return false;
+	
+	slot	= wb_seen_find_slot(wb_seen_server(server), cnick, length);
+	
+	// fall back to what was seen before the file kept servers apart
+	if(slot->key == 0)
+		slot = wb_seen_find_slot(0, cnick, length);
+	
+	if(slot->key == 0)
+		return false;
+	
+	stamp	= slot->stamp;
+	
+	if(time)
+		*time = (wi_time_interval_t) (stamp >> 8);
+	
+	if(event)
+		*event = (wb_seen_event_t) (stamp & 0xff);
+	
+	return true;
+}
+
+
+
+wi_string_t * wb_seen_description(wi_string_t *server, wi_string_t *nick) {
+	wi_string_t				*action;
+	wi_time_interval_t		time;
+	wb_seen_event_t			event;
+	
+	if(!wb_seen_lookup(server, nick, &time, &event))
+		return wi_string_with_format(WI_STR("I have not seen %@"), nick);
+	
+	switch(event) {
+		case WB_SEEN_JOIN:		action = WI_STR("joining");				break;
+		case WB_SEEN_LEAVE:		action = WI_STR("leaving");				break;
+		case WB_SEEN_SAY:		action = WI_STR("talking");				break;
+		case WB_SEEN_STATUS:	action = WI_STR("changing status");		break;
+		default:				action = WI_STR("around");				break;
+	}
+	
+	return wi_string_with_format(WI_STR("%@ was last seen %@ %@ ago"),
+		nick, action, wi_time_interval_string(wi_time_interval() - time));
+}
+
+
+
+#pragma mark -
+
+static wb_seen_map_result_t wb_seen_map(wb_seen_table_t *table, const char *path, uint64_t capacity) {
+	wb_seen_header_t	*header;
+	struct stat			sb;
+	void				*map;
+	size_t				size;
+	int					fd, error;
+	wi_boolean_t		create;
+	
+	// a capacity asks for a new empty table, otherwise the file is opened
+	// as it is and only created when missing
+	create	= (capacity > 0);
+	fd		= open(path, create ? (O_RDWR | O_CREAT | O_TRUNC) : (O_RDWR | O_CREAT), 0600);
+	
+	if(fd < 0)
+		return WB_SEEN_FAILED;
+	
+	// one process per file, a shared mapping has no other protection
+	if(flock(fd, LOCK_EX | LOCK_NB) < 0) {
+		error = errno;
+		close(fd);
+		errno = error;
+		
+		return (error == EWOULDBLOCK) ? WB_SEEN_LOCKED : WB_SEEN_FAILED;
+	}
+	
+	if(fstat(fd, &sb) < 0) {
+		error = errno;
+		close(fd);
+		errno = error;
+		
+		return WB_SEEN_FAILED;
+	}
+	
+	if(sb.st_size == 0) {
+		if(capacity == 0)
+			capacity = WB_SEEN_INITIAL_CAPACITY;
+		
+		size = sizeof(wb_seen_header_t) + capacity * sizeof(wb_seen_slot_t);
+		
+		if(ftruncate(fd, size) < 0) {
+			error = errno;
+			close(fd);
+			errno = error;
+			
+			return WB_SEEN_FAILED;
+		}
+		
+		create = true;
+	} else {
+		size = sb.st_size;
+		
+		// a file too short for a header is not a seen table
+		if(size < sizeof(wb_seen_header_t)) {
+			close(fd);
+			
+			return WB_SEEN_CORRUPT;
+		}
+	}
+	
+	map = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	
+	if(map == MAP_FAILED) {
+		error = errno;
+		close(fd);
+		errno = error;
+		
+		return WB_SEEN_FAILED;
+	}
+	
+	header = map;
+	
+	if(create) {
+		header->slot_size	= sizeof(wb_seen_slot_t);
+		header->capacity	= capacity;
+		header->count		= 0;
+		
+		__sync_synchronize();
+		
+		memcpy(header->magic, WB_SEEN_MAGIC, sizeof(header->magic));
+	}
+	else if(memcmp(header->magic, WB_SEEN_MAGIC, sizeof(header->magic)) != 0 ||
+			header->slot_size != sizeof(wb_seen_slot_t) ||
+			header->capacity == 0 ||
+			(header->capacity & (header->capacity - 1)) != 0 ||
+			size != sizeof(wb_seen_header_t) + header->capacity * sizeof(wb_seen_slot_t)) {
+		munmap(map, size);
+		close(fd);
+		
+		return WB_SEEN_CORRUPT;
+	}
+	
+	table->fd		= fd;
+	table->size		= size;
+	table->header	= header;
+	table->slots	= (wb_seen_slot_t *) (header + 1);
+	
+	return WB_SEEN_MAPPED;
+}
+
+
+
+static void wb_seen_unmap(wb_seen_table_t *table) {
+	if(!table->header)
+		return;
+	
+	msync(table->header, table->size, MS_SYNC);
+	munmap(table->header, table->size);
+	close(table->fd);
+	
+	table->fd		= -1;
+	table->size		= 0;
+	table->header	= NULL;
+	table->slots	= NULL;
+}
+
+
+
+static wi_boolean_t wb_seen_upgrade(wi_string_t *path) {
+	wb_seen_table_t				table;
+	wb_seen_header_t			*header;
+	wb_seen_legacy_slot_t		*slots;
+	wb_seen_slot_t				*slot;
+	wi_string_t					*new_path;
+	struct stat					sb;
+	void						*map;
+	uint64_t					i, capacity;
+	size_t						length;
+	int							fd;
+	wi_boolean_t				result;
+	
+	fd = open(wi_string_cstring(path), O_RDONLY);
+	
+	if(fd < 0)
+		return true;
+	
+	if(flock(fd, LOCK_EX | LOCK_NB) < 0 || fstat(fd, &sb) < 0 || (size_t) sb.st_size < sizeof(wb_seen_header_t)) {
+		close(fd);
+		
+		return true;
+	}
+	
+	map = mmap(NULL, sb.st_size, PROT_READ, MAP_SHARED, fd, 0);
+	
+	if(map == MAP_FAILED) {
+		close(fd);
+		
+		return true;
+	}
+	
+	header		= map;
+	slots		= (wb_seen_legacy_slot_t *) (header + 1);
+	capacity	= header->capacity;
+	result		= true;
+	
+	// anything but a sound first version file is left to wb_seen_map()
+	if(memcmp(header->magic, WB_SEEN_LEGACY_MAGIC, sizeof(header->magic)) != 0 ||
+	   header->slot_size != sizeof(wb_seen_legacy_slot_t) ||
+	   capacity == 0 || (capacity & (capacity - 1)) != 0 ||
+	   (size_t) sb.st_size != sizeof(wb_seen_header_t) + capacity * sizeof(wb_seen_legacy_slot_t)) {
+		munmap(map, sb.st_size);
+		close(fd);
+		
+		return true;
+	}
+	
+	new_path = wi_string_by_appending_string(path, WI_STR(".new"));
+	
+	if(wb_seen_map(&table, wi_string_cstring(new_path), capacity) != WB_SEEN_MAPPED) {
+		wi_log_error(WI_STR("Could not upgrade seen database %@: %m"), new_path);
+		
+		munmap(map, sb.st_size);
+		close(fd);
+		
+		return false;
+	}
+	
+	// old slots are kept without a server, the key is the same as before
+	// unless the nick no longer fits
+	for(i = 0; i < capacity; i++) {
+		if(slots[i].key == 0 || slots[i].length == 0)
+			continue;
+		
+		length	= WI_MIN(slots[i].length, WB_SEEN_NICK_SIZE);
+		slot	= wb_seen_slot(&table, wb_seen_key(0, slots[i].nick, length), 0, slots[i].nick, length);
+		
+		if(slot->key != 0)
+			continue;
+		
+		memcpy(slot->nick, slots[i].nick, length);
+		slot->server	= 0;
+		slot->length	= length;
+		slot->stamp		= slots[i].stamp;
+		slot->key		= wb_seen_key(0, slots[i].nick, length);
+		
+		table.header->count++;
+	}
+	
+	if(msync(table.header, table.size, MS_SYNC) < 0 ||
+	   rename(wi_string_cstring(new_path), wi_string_cstring(path)) < 0) {
+		wi_log_error(WI_STR("Could not upgrade seen database %@: %m"), path);
+		
+		unlink(wi_string_cstring(new_path));
+		
+		result = false;
+	} else {
+		wi_log_info(WI_STR("Upgraded seen database %@ with %llu nicks"),
+			path, (unsigned long long) table.header->count);
+	}
+	
+	wb_seen_unmap(&table);
+	munmap(map, sb.st_size);
+	close(fd);
+	
+	return result;
+}
+
+
+
+static wi_boolean_t wb_seen_grow(void) {
+	wb_seen_table_t		table;
+	wb_seen_slot_t		*slot;
+	wi_string_t			*new_path;
+	uint64_t			i, capacity;
+	
+	capacity	= wb_seen_table.header->capacity * 2;
+	new_path	= wi_string_by_appending_string(wb_seen_path, WI_STR(".new"));
+	
+	if(wb_seen_map(&table, wi_string_cstring(new_path), capacity) != WB_SEEN_MAPPED) {
+		wi_log_error(WI_STR("Could not grow seen database %@: %m"), new_path);
+		
+		return false;
+	}
+	
+	for(i = 0; i < wb_seen_table.header->capacity; i++) {
+		if(wb_seen_table.slots[i].key == 0)
+			continue;
+		
+		slot = wb_seen_slot(&table, wb_seen_table.slots[i].key, wb_seen_table.slots[i].server,
+			wb_seen_table.slots[i].nick, wb_seen_table.slots[i].length);
+		
+		*slot = wb_seen_table.slots[i];
+		
+		table.header->count++;
+	}
+	
+	// the new table must be on disk before it replaces the old one
+	if(msync(table.header, table.size, MS_SYNC) < 0 ||
+	   rename(wi_string_cstring(new_path), wi_string_cstring(wb_seen_path)) < 0) {
+		wi_log_error(WI_STR("Could not grow seen database %@: %m"), wb_seen_path);
+		
+		wb_seen_unmap(&table);
+		unlink(wi_string_cstring(new_path));
+		
+		return false;
+	}
+	
+	wb_seen_unmap(&wb_seen_table);
+	
+	wb_seen_table = table;
+	
+	wi_log_debug(WI_STR("Seen database grown to %llu slots"), (unsigned long long) capacity);
+	
+	return true;
+}
+
+
+
+static wb_seen_slot_t * wb_seen_find_slot(uint32_t server, const char *nick, size_t length) {
+	return wb_seen_slot(&wb_seen_table, wb_seen_key(server, nick, length), server, nick, length);
+}
+
+
+
+static wb_seen_slot_t * wb_seen_slot(wb_seen_table_t *table, uint64_t key, uint32_t server, const char *nick, size_t length) {
+	wb_seen_slot_t		*slot;
+	uint64_t			mask, i;
+	
+	mask	= table->header->capacity - 1;
+	i		= key & mask;
+	
+	// the table never fills up, so an empty slot always ends the probe
+	while(true) {
+		slot = &table->slots[i];
+		
+		if(slot->key == 0)
+			return slot;
+		
+		if(slot->key == key && slot->server == server && slot->length == length &&
+		   strncasecmp(slot->nick, nick, length) == 0)
+			return slot;
+		
+		i = (i + 1) & mask;
+	}
+}
+
+
+
+static uint64_t wb_seen_key(uint32_t server, const char *nick, size_t length) {
+	uint64_t		key;
+	size_t			i;
+	
+	// FNV-1a over the server and the lowercased nick, 0 marks an empty
+	// slot; slots without a server hash the nick alone, as the first
+	// version of the file did
+	key = 14695981039346656037ULL;
+	
+	if(server != 0) {
+		for(i = 0; i < sizeof(server); i++) {
+			key ^= (server >> (i * 8)) & 0xff;
+			key *= 1099511628211ULL;
+		}
+	}
+	
+	for(i = 0; i < length; i++) {
+		key ^= (uint8_t) tolower((unsigned char) nick[i]);
+		key *= 1099511628211ULL;
+	}
+	
+	return key ? key : 1;
+}
+
+
+
+static uint32_t wb_seen_server(wi_string_t *server) {
+	const char		*string;
+	uint32_t		key;
+	
+	if(!server)
+		return 0;
+	
+	// FNV-1a over the lowercased host name, 0 is for slots without one
+	key = 2166136261U;
+	
+	for(string = wi_string_cstring(server); *string; string++) {
+		key ^= (uint8_t) tolower((unsigned char) *string);
+		key *= 16777619U;
+	}
+	
+	return key ? key : 1;
+}
@@ -0,0 +1,55 @@
+/* $Id$ */
+
+/*
+ *  Copyright (c) 2012 Rafael Warnault
+ *  All rights reserved.
+ * 
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef WR_SEEN_H
+#define WR_SEEN_H 1
+
+#include <wired/wired.h>
+
+/**
+ * What a user was last seen doing
+ */
+enum _wb_seen_event {
+	WB_SEEN_NONE				= 0,
+	WB_SEEN_JOIN				= 1,
+	WB_SEEN_LEAVE				= 2,
+	WB_SEEN_SAY					= 3,
+	WB_SEEN_STATUS				= 4
+};
+typedef enum _wb_seen_event		wb_seen_event_t;
+
+
+wi_boolean_t					wb_seen_open(wi_string_t *);
+void							wb_seen_close(void);
+
+void							wb_seen_note(wi_string_t *, wi_string_t *, wb_seen_event_t);
+wi_boolean_t					wb_seen_lookup(wi_string_t *, wi_string_t *, wi_time_interval_t *, wb_seen_event_t *);
+
+wi_string_t *					wb_seen_description(wi_string_t *, wi_string_t *);
+
+#endif /* WR_SEEN_H */
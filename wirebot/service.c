@@ -29,15 +29,40 @@
 #include <wired/wired.h>
 #include "spec.h"
 #include "client.h"
+#include "intmap.h"
+#include "main.h"
 #include "service.h"
+#include "servicecache.h"
 #include "output.h"
 #include "settings.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <unistd.h>
+#include <errno.h>
 #include <curl/curl.h>
 #include <regex.h>
 
+/*
+	Lookups run on a curl multi handle driven by the runloop: curl tells us
+	which sockets to watch and when to wake it up, the sockets are added to
+	the runloop next to the server connection, and the callback of a lookup
+	is called from there once the response is in. A slow service no longer
+	holds up the bot.
+	
+	At most "service lookups" requests run at once, the others wait in a
+	queue. Each request has a deadline of "service timeout" seconds from
+	the moment it was made, time spent in the queue included, or none when
+	that is 0.
+	
+	Finished easy handles are kept for the next requests, and a share
+	object holds the DNS and TLS session caches, while the multi handle
+	keeps connections open between requests. A burst of uploads then costs
+	one resolution and one handshake rather than one per file.
+*/
+
+#define WB_SERVICES_MAX_IDLE			8
+
 
 struct MemoryStruct {
   char *memory;
@@ -70,13 +95,27 @@ struct _wb_service {
 
 	wi_string_t 					*name;
 	wi_string_t 					*type;
-	wi_string_t 					*file_path;
-	wi_string_t 					*readable_filename;
-	wi_string_t 					*text;
 };  
 
+struct _wb_service_request {
+	wi_runtime_base_t				base;
+
+	wb_service_t					*service;
+	wi_string_t						*path;
+	wi_string_t						*name;
+	CURL							*curl;
+	struct MemoryStruct				chunk;
+	wi_time_interval_t				time;
+	wi_time_interval_t				deadline;
+
+	wb_service_callback_func_t		*callback;
+	wi_runtime_instance_t			*context;
+};
+typedef struct _wb_service_request	wb_service_request_t;
+
 static void							wb_service_dealloc(wi_runtime_instance_t *);
 static wi_string_t * 				wb_service_description(wi_runtime_instance_t *);
+static void							wb_service_request_dealloc(wi_runtime_instance_t *);
 
 static wi_runtime_id_t				wb_service_runtime_id = WI_RUNTIME_ID_NULL;
 static wi_runtime_class_t			wb_service_runtime_class = {
@@ -88,12 +127,40 @@ static wi_runtime_class_t			wb_service_runtime_class = {
 	NULL
 };
 
+static wi_runtime_id_t				wb_service_request_runtime_id = WI_RUNTIME_ID_NULL;
+static wi_runtime_class_t			wb_service_request_runtime_class = {
+	"wb_service_request_t",
+	wb_service_request_dealloc,
+	NULL,
+	NULL,
+	NULL,
+	NULL
+};
+
 
 
 static wb_service_t*				_wb_service_load_with_node(wb_service_t *, xmlNodePtr);
-static wi_string_t * 				_wb_service_parse_for_human_readable_name(wb_service_t *);
-static wi_string_t * 				_wb_service_curl_request(wb_service_t *, wi_string_t *) ;
-static wi_boolean_t 				_wb_service_format_xml_output(wb_service_t *, wb_watcher_t *, wi_string_t *);
+static wi_string_t * 				_wb_service_parse_for_human_readable_name(wb_service_t *, wi_string_t *);
+static wi_string_t * 				_wb_service_url(wb_service_t *, wi_string_t *);
+static wi_boolean_t 				_wb_service_parse_xml_output(wb_service_t *, wi_string_t *, wi_string_t **);
+static wi_string_t * 				_wb_service_text(wb_service_t *, wi_string_t *, wi_string_t *);
+
+static void							_wb_services_start_requests(void);
+static void							_wb_services_finish_requests(void);
+static void							_wb_services_finish_request(wb_service_request_t *, wi_string_t *);
+static int							_wb_services_socket_function(CURL *, curl_socket_t, int, void *, void *);
+static int							_wb_services_timer_function(CURLM *, long, void *);
+static wi_boolean_t					_wb_services_runloop_callback(wi_socket_t *);
+
+static CURLM						*wb_services_multi;
+static CURLSH						*wb_services_share;
+static CURL							*wb_services_idle[WB_SERVICES_MAX_IDLE];
+static wi_uinteger_t				wb_services_idle_count;
+
+static wi_mutable_array_t			*wb_services_queued;
+static wi_mutable_array_t			*wb_services_running;
+static wr_intmap_t					*wb_services_sockets;
+static wi_time_interval_t			wb_services_timer;
 
 
 
@@ -102,6 +169,96 @@ static wi_boolean_t 				_wb_service_format_xml_output(wb_service_t *, wb_watcher
 
 void wb_services_init(void) {
 	wb_service_runtime_id = wi_runtime_register_class(&wb_service_runtime_class);
+	wb_service_request_runtime_id = wi_runtime_register_class(&wb_service_request_runtime_class);
+
+	wb_services_queued		= wi_array_init(wi_mutable_array_alloc());
+	wb_services_running		= wi_array_init(wi_mutable_array_alloc());
+	wb_services_sockets		= wr_intmap_create(0);
+
+	curl_global_init(CURL_GLOBAL_ALL);
+
+	wb_services_share = curl_share_init();
+
+	if(wb_services_share) {
+		curl_share_setopt(wb_services_share, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+		curl_share_setopt(wb_services_share, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
+	}
+
+	wb_services_multi = curl_multi_init();
+
+	if(wb_services_multi) {
+		curl_multi_setopt(wb_services_multi, CURLMOPT_SOCKETFUNCTION, _wb_services_socket_function);
+		curl_multi_setopt(wb_services_multi, CURLMOPT_TIMERFUNCTION, _wb_services_timer_function);
+	}
+}
+
+
+
+void wb_services_cleanup(void) {
+	wi_enumerator_t			*enumerator;
+	wb_service_request_t	*request;
+	wi_uinteger_t			i;
+
+	enumerator = wi_array_data_enumerator(wb_services_running);
+
+	while((request = wi_enumerator_next_data(enumerator))) {
+		curl_multi_remove_handle(wb_services_multi, request->curl);
+		curl_easy_cleanup(request->curl);
+
+		request->curl = NULL;
+	}
+
+	wi_mutable_array_remove_all_data(wb_services_running);
+	wi_mutable_array_remove_all_data(wb_services_queued);
+
+	for(i = 0; i < wb_services_idle_count; i++)
+		curl_easy_cleanup(wb_services_idle[i]);
+
+	wb_services_idle_count = 0;
+
+	if(wb_services_multi) {
+		curl_multi_cleanup(wb_services_multi);
+
+		wb_services_multi = NULL;
+	}
+
+	if(wb_services_share) {
+		curl_share_cleanup(wb_services_share);
+
+		wb_services_share = NULL;
+	}
+
+	curl_global_cleanup();
+}
+
+
+
+#pragma mark -
+
+wi_time_interval_t wb_services_timeout(void) {
+	wi_time_interval_t		timeout;
+
+	if(wb_services_timer == 0.0)
+		return 30.0;
+
+	timeout = wb_services_timer - wi_time_interval();
+
+	return timeout < 0.01 ? 0.01 : timeout;
+}
+
+
+
+void wb_services_run(void) {
+	int			running;
+
+	if(wb_services_timer == 0.0 || wb_services_timer > wi_time_interval())
+		return;
+
+	wb_services_timer = 0.0;
+
+	curl_multi_socket_action(wb_services_multi, CURL_SOCKET_TIMEOUT, 0, &running);
+
+	_wb_services_finish_requests();
 }
 
 
@@ -120,9 +277,6 @@ wb_service_t * wb_service_alloc(void) {
 wb_service_t * wb_service_init(wb_service_t *service, xmlNodePtr node) {
 	service->name 					= NULL;
 	service->type 					= NULL;
-	service->file_path 				= NULL;
-	service->readable_filename 		= NULL;
-	service->text 					= NULL;
 
 	return _wb_service_load_with_node(service, node);
 }
@@ -137,57 +291,62 @@ wi_string_t * wb_service_type(wb_service_t *service) {
 	return service->type;
 }
 
-wi_string_t * wb_service_file_path(wb_service_t *service) {
-	return service->file_path;
-}
-
-wi_string_t * wb_service_readable_filename(wb_service_t *service) {
-	return service->readable_filename;
-}
 
-wi_string_t * wb_service_text(wb_service_t *service) {
-	return service->text;
-}
-
-void wb_service_set_file_path(wb_service_t *service, wi_string_t *file_path) {
-	service->file_path = wi_retain(file_path);
-}
 
 
+#pragma mark -
 
+wi_boolean_t wb_service_lookup(wb_service_t *service, wi_string_t *path, wb_service_callback_func_t *callback, wi_runtime_instance_t *context) {
+	wb_service_request_t	*request;
+	wi_string_t 			*readable_name, *fields;
+	wi_integer_t			timeout;
 
-#pragma mark -
+	if(!path || !wb_services_multi)
+		return false;
 
-wi_boolean_t wb_service_execute(wb_service_t *service, wb_watcher_t *watcher) {
-	wi_string_t 			*readable_name, *xml_string;
-	wi_string_t 			*board, *subject, *text;
-	wb_output_t				*output;
-	wi_p7_message_t 		*message;
+	readable_name = _wb_service_parse_for_human_readable_name(service, path);
 
-	if(!service->file_path)
+	if(!readable_name || wi_string_length(readable_name) == 0)
 		return false;
 
-	readable_name = _wb_service_parse_for_human_readable_name(service);
+	// titles seen before are answered without asking the service
+	switch(wb_service_cache_lookup(service->name, readable_name, &fields)) {
+		case WB_SERVICE_CACHE_HIT:
+			wi_log_info(WI_STR("Service: %@ found « %@ » in the cache"), service->name, readable_name);
 
-	wi_log_info(WI_STR("Service: %@ searching « %@ »"), service->name, readable_name);
+			(*callback)(service, path, _wb_service_text(service, path, fields), context);
+
+			return true;
 
-	if(readable_name && wi_string_length(readable_name) > 0) {
-		service->readable_filename = wi_retain(readable_name);
-		xml_string = _wb_service_curl_request(service, service->readable_filename);
+		case WB_SERVICE_CACHE_NOT_FOUND:
+			wi_log_info(WI_STR("Service: %@ did not find « %@ » last time"), service->name, readable_name);
 
-		wi_log_debug(WI_STR("Service output: %@"), xml_string);
+			(*callback)(service, path, NULL, context);
 
-		if(_wb_service_format_xml_output(service, watcher, xml_string)) {
 			return true;
-		}
+
+		case WB_SERVICE_CACHE_MISS:
+			break;
 	}
-	return false;
-}
 
-void wb_service_cleanup(wb_service_t *service) {
-	service->file_path 				= NULL;
-	service->readable_filename 		= NULL;
-	service->text 					= NULL;
+	wi_log_info(WI_STR("Service: %@ searching « %@ »"), service->name, readable_name);
+
+	request				= wi_runtime_create_instance(wb_service_request_runtime_id, sizeof(wb_service_request_t));
+	request->service	= wi_retain(service);
+	request->path		= wi_retain(path);
+	request->name		= wi_retain(readable_name);
+	request->time		= wi_time_interval();
+	timeout				= wi_config_integer_for_name(wd_config, WI_STR("service timeout"));
+	request->deadline	= timeout > 0 ? request->time + timeout : 0.0;
+	request->callback	= callback;
+	request->context	= wi_retain(context);
+
+	wi_mutable_array_add_data(wb_services_queued, request);
+	wi_release(request);
+
+	_wb_services_start_requests();
+
+	return true;
 }
 
 
@@ -209,15 +368,15 @@ static wb_service_t * _wb_service_load_with_node(wb_service_t *service, xmlNodeP
 }
 
 
-static wi_string_t * _wb_service_parse_for_human_readable_name(wb_service_t *service) {
+static wi_string_t * _wb_service_parse_for_human_readable_name(wb_service_t *service, wi_string_t *path) {
 	wi_boolean_t			is_file;
 	wi_string_t 			*file_name, *clean_name, *readable_name, *drop_string;
 	wi_regexp_t 			*ext_regex, *tail_regex, *nose_regex;
 
-	if(!service->file_path)
+	if(!path)
 			return NULL;
 
-	file_name 		= wi_string_last_path_component(service->file_path);
+	file_name 		= wi_string_last_path_component(path);
 	clean_name		= wi_string_by_deleting_path_extension(file_name);
 	clean_name		= wi_string_by_replacing_string_with_string(clean_name, WI_STR("."), WI_STR(" "), 0);
 	clean_name		= wi_string_lowercase_string(clean_name);
@@ -254,95 +413,319 @@ static wi_string_t * _wb_service_parse_for_human_readable_name(wb_service_t *ser
 }
 
 
-static wi_string_t * _wb_service_curl_request(wb_service_t *service, wi_string_t *name) {
-	wi_string_t 			*api_key, *url, *result;
-	CURL 					*curl;  
-	CURLcode 				res;
-	struct MemoryStruct 	chunk;
 
-	curl_global_init(CURL_GLOBAL_ALL);
-
-	result 			= NULL;    			
-	curl 			= curl_easy_init();
-	chunk.memory 	= malloc(1);
-	chunk.size 		= 0;
-
-	if(curl) {
-		api_key = wi_config_string_for_name(wd_config, WI_STR("omdb api key"));
+static wi_string_t * _wb_service_url(wb_service_t *service, wi_string_t *name) {
+	wi_string_t 			*api_key, *url;
 
-		url		= wi_string_with_format(WI_STR("http://www.omdbapi.com/?apiKey=%@&t=%@&r=xml"), api_key, name);
-		url 	= wi_string_by_replacing_string_with_string(url, WI_STR(" "), WI_STR("+"), 0);
+	api_key = wi_config_string_for_name(wd_config, WI_STR("omdb api key"));
 
-		wi_log_debug(WI_STR("Service URL: %@"), url);
+	url		= wi_string_with_format(WI_STR("http://www.omdbapi.com/?apiKey=%@&t=%@&r=xml"), api_key, name);
+	url 	= wi_string_by_replacing_string_with_string(url, WI_STR(" "), WI_STR("+"), 0);
 
-		curl_easy_setopt(curl, CURLOPT_URL, wi_string_cstring(url));
-		curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, WriteMemoryCallback);
-		curl_easy_setopt(curl, CURLOPT_WRITEDATA, (void *)&chunk);
-		curl_easy_setopt(curl, CURLOPT_USERAGENT, "libcurl-agent/1.0");
-
-		/* Perform the request, res will get the return code */
-		res 	= curl_easy_perform(curl);
+	return url;
+}
 
-		/* Check for errors */
-		if(res != CURLE_OK)
-		  fprintf(stderr, "ERROR: curl_easy_perform() failed: %s\n", curl_easy_strerror(res));
 
-		if(chunk.memory) {
-			result = wi_string_with_format(WI_STR("%s"), chunk.memory);
-    		free(chunk.memory);
-		}
-		curl_easy_cleanup(curl);
-	}
-	curl_global_cleanup();
-	return result;
-}
+static wi_boolean_t _wb_service_parse_xml_output(wb_service_t *service, wi_string_t *xml_string, wi_string_t **fields) {
+	wi_mutable_string_t 	*string;
+	wi_string_t 			*response, *value;
+	xmlDocPtr				doc;
+	xmlNodePtr				root, node, next;
+	const char				*names[] = { "title", "year", "genre", "imdbID", "poster" };
+	wi_uinteger_t			i;
 
+	*fields			= NULL;
+	doc 			= xmlParseDoc((const xmlChar *) wi_string_cstring(xml_string));
 
-static wi_boolean_t _wb_service_format_xml_output(wb_service_t *service, wb_watcher_t *watcher, wi_string_t *xml_string) {
-	wi_string_t 	*string, *response;
-	xmlDocPtr		doc;
-	xmlNodePtr		root, node, next;
-	int				length;
+	if(!doc)
+		return false;
 
-	string 			= wi_mutable_string();
-	doc 			= xmlParseDoc(wi_string_cstring(xml_string));
 	root 			= xmlDocGetRootElement(doc);
-	response 		= wi_xml_node_attribute_with_name(root, WI_STR("response"));
+	response 		= root ? wi_xml_node_attribute_with_name(root, WI_STR("response")) : NULL;
 
-	if(!wi_is_equal(response, WI_STR("True"))) {
-		xmlCleanupParser();
+	if(!response) {
+		xmlFreeDoc(doc);
 		return false;
 	}
 
+	// an answer of False is a title the service does not know
+	if(!wi_is_equal(response, WI_STR("True"))) {
+		xmlFreeDoc(doc);
+		return true;
+	}
+
+	// the fields are kept tab separated, which is also how they are cached
 	for(node = root->children; node != NULL; node = next) {
 		next = node->next;
 
 		if(node->type == XML_ELEMENT_NODE) {
 			if(strcmp((const char *) node->name, "movie") == 0) {
-				wi_mutable_string_append_format(string, WI_STR("[b]Title:[/b] %@\n"), 
-					wi_xml_node_attribute_with_name(node, WI_STR("title")));
+				string = wi_mutable_string();
 
-				wi_mutable_string_append_format(string, WI_STR("[b]Year:[/b] %@\n"), 
-					wi_xml_node_attribute_with_name(node, WI_STR("year")));
+				for(i = 0; i < sizeof(names) / sizeof(*names); i++) {
+					value = wi_xml_node_attribute_with_name(node, wi_string_with_cstring(names[i]));
 
-				wi_mutable_string_append_format(string, WI_STR("[b]Genre:[/b] %@\n"), 
-					wi_xml_node_attribute_with_name(node, WI_STR("genre")));
+					if(i > 0)
+						wi_mutable_string_append_string(string, WI_STR("\t"));
 
-				wi_mutable_string_append_format(string, WI_STR("[b]IMDB:[/b] [url]http://www.imdb.com/title/%@[/url]\n"), 
-					wi_xml_node_attribute_with_name(node, WI_STR("imdbID")));
+					if(value)
+						wi_mutable_string_append_string(string, wi_string_by_replacing_string_with_string(value, WI_STR("\t"), WI_STR(" "), 0));
+				}
 
-				wi_mutable_string_append_format(string, WI_STR("[b]Path:[/b] %@\n\n"), 
-					service->file_path);
+				*fields = string;
+			}
+		}
+	}
 
-				wi_mutable_string_append_format(string, WI_STR("[img]%@[/img]"), 
-					wi_xml_node_attribute_with_name(node, WI_STR("poster")));
+	xmlFreeDoc(doc);
 
-				service->text 	= wi_retain(string);
+	return true;
+}
+
+
+static wi_string_t * _wb_service_text(wb_service_t *service, wi_string_t *path, wi_string_t *fields) {
+	wi_mutable_string_t 	*string;
+	wi_array_t 				*values;
+
+	values = wi_string_components_separated_by_string(fields, WI_STR("\t"));
+
+	if(wi_array_count(values) < 5)
+		return NULL;
+
+	string = wi_mutable_string();
+
+	wi_mutable_string_append_format(string, WI_STR("[b]Title:[/b] %@\n"), WI_ARRAY(values, 0));
+	wi_mutable_string_append_format(string, WI_STR("[b]Year:[/b] %@\n"), WI_ARRAY(values, 1));
+	wi_mutable_string_append_format(string, WI_STR("[b]Genre:[/b] %@\n"), WI_ARRAY(values, 2));
+	wi_mutable_string_append_format(string, WI_STR("[b]IMDB:[/b] [url]http://www.imdb.com/title/%@[/url]\n"), WI_ARRAY(values, 3));
+	wi_mutable_string_append_format(string, WI_STR("[b]Path:[/b] %@\n\n"), path);
+	wi_mutable_string_append_format(string, WI_STR("[img]%@[/img]"), WI_ARRAY(values, 4));
+
+	return string;
+}
+
+
+
+#pragma mark -
+
+static void _wb_services_start_requests(void) {
+	wb_service_request_t	*request;
+	wi_time_interval_t		interval;
+	wi_uinteger_t			limit;
+	CURL					*curl;
+
+	limit = wi_config_integer_for_name(wd_config, WI_STR("service lookups"));
+
+	if(limit == 0)
+		limit = 1;
+
+	curl_multi_setopt(wb_services_multi, CURLMOPT_MAX_TOTAL_CONNECTIONS, (long) limit);
+
+	while(wi_array_count(wb_services_running) < limit && wi_array_count(wb_services_queued) > 0) {
+		request = wi_autorelease(wi_retain(WI_ARRAY(wb_services_queued, 0)));
+
+		wi_mutable_array_remove_data_at_index(wb_services_queued, 0);
+
+		interval = wi_time_interval();
+
+		if(request->deadline > 0.0 && interval >= request->deadline) {
+			wi_log_warn(WI_STR("Service: %@ lookup of « %@ » timed out in the queue"), request->service->name, request->name);
+
+			_wb_services_finish_request(request, NULL);
+
+			continue;
+		}
+
+		if(wb_services_idle_count > 0) {
+			curl = wb_services_idle[--wb_services_idle_count];
+		} else {
+			curl = curl_easy_init();
+
+			if(!curl) {
+				_wb_services_finish_request(request, NULL);
+
+				continue;
 			}
+
+			if(wb_services_share)
+				curl_easy_setopt(curl, CURLOPT_SHARE, wb_services_share);
+
+			curl_easy_setopt(curl, CURLOPT_WRITEFUNCTION, WriteMemoryCallback);
+			curl_easy_setopt(curl, CURLOPT_USERAGENT, "libcurl-agent/1.0");
+			curl_easy_setopt(curl, CURLOPT_NOSIGNAL, 1L);
+			curl_easy_setopt(curl, CURLOPT_DNS_CACHE_TIMEOUT, 300L);
+			curl_easy_setopt(curl, CURLOPT_TCP_KEEPALIVE, 1L);
 		}
+
+		request->curl			= curl;
+		request->chunk.memory	= malloc(1);
+		request->chunk.size		= 0;
+
+		wi_log_debug(WI_STR("Service URL: %@"), _wb_service_url(request->service, request->name));
+
+		curl_easy_setopt(curl, CURLOPT_URL, wi_string_cstring(_wb_service_url(request->service, request->name)));
+		curl_easy_setopt(curl, CURLOPT_WRITEDATA, (void *) &request->chunk);
+		curl_easy_setopt(curl, CURLOPT_PRIVATE, (void *) request);
+
+		// what is left of the deadline, the queue took its share; at least
+		// a millisecond, 0 would lift the limit, which a reused handle
+		// must lose when there is no deadline
+		if(request->deadline > 0.0)
+			curl_easy_setopt(curl, CURLOPT_TIMEOUT_MS, WI_MAX(1L, (long) ((request->deadline - interval) * 1000.0)));
+		else
+			curl_easy_setopt(curl, CURLOPT_TIMEOUT_MS, 0L);
+
+		curl_easy_setopt(curl, CURLOPT_CONNECTTIMEOUT,
+			(long) wi_config_integer_for_name(wd_config, WI_STR("service connect timeout")));
+
+		wi_mutable_array_add_data(wb_services_running, request);
+
+		curl_multi_add_handle(wb_services_multi, curl);
 	}
+}
+
 
-	xmlCleanupParser();
+
+static void _wb_services_finish_requests(void) {
+	wb_service_request_t	*request;
+	wi_string_t				*result, *fields, *text;
+	CURLMsg					*msg;
+	char					*data;
+	int						left;
+
+	while((msg = curl_multi_info_read(wb_services_multi, &left))) {
+		if(msg->msg != CURLMSG_DONE)
+			continue;
+
+		data = NULL;
+
+		curl_easy_getinfo(msg->easy_handle, CURLINFO_PRIVATE, &data);
+
+		request = (wb_service_request_t *) data;
+
+		if(!request)
+			continue;
+
+		text = NULL;
+
+		if(msg->data.result != CURLE_OK) {
+			wi_log_warn(WI_STR("Service: %@ lookup of « %@ » failed: %s"),
+				request->service->name, request->name, curl_easy_strerror(msg->data.result));
+		} else {
+			wi_log_debug(WI_STR("Service: %@ answered in %.3f seconds"),
+				request->service->name, wi_time_interval() - request->time);
+
+			if(request->chunk.memory) {
+				result = wi_string_with_format(WI_STR("%s"), request->chunk.memory);
+
+				wi_log_debug(WI_STR("Service output: %@"), result);
+
+				if(_wb_service_parse_xml_output(request->service, result, &fields)) {
+					wb_service_cache_store(request->service->name, request->name, fields);
+
+					if(fields)
+						text = _wb_service_text(request->service, request->path, fields);
+				}
+			}
+		}
+
+		curl_multi_remove_handle(wb_services_multi, request->curl);
+
+		if(wb_services_idle_count < WB_SERVICES_MAX_IDLE)
+			wb_services_idle[wb_services_idle_count++] = request->curl;
+		else
+			curl_easy_cleanup(request->curl);
+
+		request->curl = NULL;
+
+		wi_retain(request);
+		wi_mutable_array_remove_data(wb_services_running, request);
+
+		_wb_services_finish_request(request, text);
+
+		wi_release(request);
+	}
+
+	_wb_services_start_requests();
+}
+
+
+
+static void _wb_services_finish_request(wb_service_request_t *request, wi_string_t *text) {
+	free(request->chunk.memory);
+
+	request->chunk.memory = NULL;
+
+	(*request->callback)(request->service, request->path, text, request->context);
+}
+
+
+
+static int _wb_services_socket_function(CURL *curl, curl_socket_t sd, int what, void *userp, void *socketp) {
+	wi_socket_t			*socket = socketp;
+	int					fd;
+
+	if(what == CURL_POLL_REMOVE) {
+		if(socket) {
+			curl_multi_assign(wb_services_multi, sd, NULL);
+			wr_intmap_remove_data_for_key(wb_services_sockets, wi_socket_descriptor(socket));
+			wr_runloop_remove_socket(socket);
+			wi_release(socket);
+		}
+
+		return 0;
+	}
+
+	if(!socket) {
+		// the runloop socket closes its descriptor when released, so it
+		// gets a copy and curl keeps its own
+		fd = dup(sd);
+
+		if(fd < 0) {
+			wi_log_warn(WI_STR("Service: could not watch socket: %s"), strerror(errno));
+
+			return -1;
+		}
+
+		socket = wi_socket_init_with_descriptor(wi_socket_alloc(), fd);
+
+		wr_intmap_set_data_for_key(wb_services_sockets, (void *) (intptr_t) (sd + 1), fd);
+		curl_multi_assign(wb_services_multi, sd, socket);
+		wr_runloop_add_socket(socket, &_wb_services_runloop_callback);
+	}
+
+	if(what == CURL_POLL_IN)
+		wi_socket_set_direction(socket, WI_SOCKET_READ);
+	else if(what == CURL_POLL_OUT)
+		wi_socket_set_direction(socket, WI_SOCKET_WRITE);
+	else
+		wi_socket_set_direction(socket, WI_SOCKET_READ | WI_SOCKET_WRITE);
+
+	return 0;
+}
+
+
+
+static int _wb_services_timer_function(CURLM *multi, long timeout, void *userp) {
+	// curl is not to be called back from here, the runloop does it
+	wb_services_timer = (timeout < 0) ? 0.0 : wi_time_interval() + (timeout / 1000.0);
+
+	return 0;
+}
+
+
+
+static wi_boolean_t _wb_services_runloop_callback(wi_socket_t *socket) {
+	intptr_t			sd;
+	int					running;
+
+	sd = (intptr_t) wr_intmap_data_for_key(wb_services_sockets, wi_socket_descriptor(socket)) - 1;
+
+	if(sd >= 0) {
+		curl_multi_socket_action(wb_services_multi, (curl_socket_t) sd, 0, &running);
+
+		_wb_services_finish_requests();
+	}
 
 	return true;
 }
@@ -362,15 +745,6 @@ static void wb_service_dealloc(wi_runtime_instance_t *instance) {
 
 	if(service->type)
 		wi_release(service->type);
-
-	if(service->file_path)
-		wi_release(service->file_path);
-
-	if(service->text)
-		wi_release(service->text);
-
-	if(service->readable_filename)
-		wi_release(service->readable_filename);
 }
 
 static wi_string_t * wb_service_description(wi_runtime_instance_t *instance) {
@@ -382,4 +756,13 @@ static wi_string_t * wb_service_description(wi_runtime_instance_t *instance) {
 	return string;
 }
 
+static void wb_service_request_dealloc(wi_runtime_instance_t *instance) {
+	wb_service_request_t	*request = instance;
+
+	free(request->chunk.memory);
 
+	wi_release(request->service);
+	wi_release(request->path);
+	wi_release(request->name);
+	wi_release(request->context);
+}
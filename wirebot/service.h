@@ -40,18 +40,19 @@
 
 typedef struct _wb_service		wb_service_t;
 
+typedef void					wb_service_callback_func_t(wb_service_t *, wi_string_t *, wi_string_t *, wi_runtime_instance_t *);
+
 void 							wb_services_init(void);
+void							wb_services_cleanup(void);
+
+wi_time_interval_t				wb_services_timeout(void);
+void							wb_services_run(void);
 
 wb_service_t * 					wb_service_alloc(void);
 wb_service_t *					wb_service_init(wb_service_t *, xmlNodePtr);
 
 wi_string_t *					wb_service_type(wb_service_t *);
-wi_string_t *					wb_service_file_path(wb_service_t *);
-wi_string_t *					wb_service_readable_filename(wb_service_t *);
-wi_string_t *					wb_service_text(wb_service_t *);
-void 							wb_service_set_file_path(wb_service_t *, wi_string_t *);
 
-wi_boolean_t 					wb_service_execute(wb_service_t *, wb_watcher_t *);
-void 							wb_service_cleanup(wb_service_t *);
+wi_boolean_t 					wb_service_lookup(wb_service_t *, wi_string_t *, wb_service_callback_func_t *, wi_runtime_instance_t *);
 
 #endif /* WR_SERVICE_H */
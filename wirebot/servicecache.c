@@ -0,0 +1,617 @@
+/* $Id$ */
+
+/*
+ *  Copyright (c) 2012 Rafael Warnault
+ *  All rights reserved.
+ * 
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "config.h"
+
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <wired/wired.h>
+
+#include "servicecache.h"
+#include "settings.h"
+
+/*
+	Results of service lookups, so a title is not looked up again for every
+	re-upload, duplicate or relisting. Entries are keyed by the service name
+	and the normalized query, and hold the parsed result, or nothing when
+	the service did not find the title. They expire after "service cache
+	ttl" seconds, or "service cache negative ttl" for titles not found.
+	
+	The file is an append-only log of records, a fixed header followed by
+	the key and the value. At startup the log is read once to build an
+	index in memory of where the last value of each key lives, values are
+	read from the file when they are hit. An update appends a record and
+	moves the index, so a crash loses at most the record being written, a
+	torn record at the end is cut off when the log is read again.
+	
+	When most of the log is made of replaced or expired records, at startup
+	or after a store, it is rewritten with the live ones next to the old
+	one and renamed over it.
+*/
+
+#define WB_SERVICE_CACHE_MAGIC			"WBSCACH1"
+#define WB_SERVICE_CACHE_RECORD_MAGIC	0x43534257
+#define WB_SERVICE_CACHE_MAX_LENGTH		65536
+
+struct _wb_service_cache_record {
+	uint32_t						magic;
+	uint32_t						key_length;
+	uint32_t						value_length;
+	uint32_t						found;
+	int64_t							expires;
+};
+typedef struct _wb_service_cache_record	wb_service_cache_record_t;
+
+struct _wb_service_cache_entry {
+	wi_string_t						*key;
+	off_t							offset;
+	uint32_t						length;
+	uint32_t						found;
+	int64_t							expires;
+};
+typedef struct _wb_service_cache_entry	wb_service_cache_entry_t;
+
+enum _wb_service_cache_state {
+	WB_SERVICE_CACHE_READ				= 0,
+	WB_SERVICE_CACHE_CORRUPT,
+	WB_SERVICE_CACHE_FAILED
+};
+typedef enum _wb_service_cache_state	wb_service_cache_state_t;
+
+
+static wb_service_cache_state_t		wb_service_cache_read(void);
+static wi_boolean_t					wb_service_cache_needs_compaction(void);
+static wi_boolean_t					wb_service_cache_compact(void);
+static wi_boolean_t					wb_service_cache_append(int, off_t *, wi_string_t *, const char *, uint32_t, uint32_t, int64_t);
+static wb_service_cache_entry_t *	wb_service_cache_entry(wi_string_t *, wi_boolean_t);
+static wi_string_t *				wb_service_cache_key(wi_string_t *, wi_string_t *);
+
+
+static wi_string_t					*wb_service_cache_path;
+static int							wb_service_cache_fd = -1;
+static off_t						wb_service_cache_size;
+
+// the dictionary maps keys to their index in the entries, plus one
+static wi_mutable_dictionary_t		*wb_service_cache_index;
+static wb_service_cache_entry_t		*wb_service_cache_entries;
+static wi_uinteger_t				wb_service_cache_count;
+static wi_uinteger_t				wb_service_cache_capacity;
+static wi_uinteger_t				wb_service_cache_records;
+
+static wi_uinteger_t				wb_service_cache_hits;
+static wi_uinteger_t				wb_service_cache_negative_hits;
+static wi_uinteger_t				wb_service_cache_misses;
+static wi_uinteger_t				wb_service_cache_expired;
+
+
+
+#pragma mark -
+
+wi_boolean_t wb_service_cache_open(wi_string_t *path) {
+	wi_string_t					*bad_path;
+	wb_service_cache_state_t	state;
+	
+	wb_service_cache_close();
+	
+	wb_service_cache_path	= wi_retain(path);
+	wb_service_cache_index	= wi_dictionary_init_with_capacity_and_callbacks(wi_mutable_dictionary_alloc(),
+		0, wi_dictionary_default_key_callbacks, wi_dictionary_null_value_callbacks);
+	
+	state = wb_service_cache_read();
+	
+	// keep a file that is not a cache aside for inspection and start over,
+	// a file that could not be read is left alone for the next start
+	if(state == WB_SERVICE_CACHE_CORRUPT) {
+		bad_path = wi_string_by_appending_string(path, WI_STR(".bad"));
+		
+		wi_log_warn(WI_STR("Could not use service cache %@, moving it to %@"), path, bad_path);
+		
+		if(rename(wi_string_cstring(path), wi_string_cstring(bad_path)) < 0)
+			state = WB_SERVICE_CACHE_FAILED;
+		else
+			state = wb_service_cache_read();
+	}
+	
+	if(state != WB_SERVICE_CACHE_READ) {
+		if(state == WB_SERVICE_CACHE_FAILED)
+			wi_log_error(WI_STR("Could not open service cache %@: %m"), path);
+		else
+			wi_log_error(WI_STR("Could not open service cache %@"), path);
+		
+		wb_service_cache_close();
+		
+		return false;
+	}
+	
+	if(wb_service_cache_needs_compaction()) {
+		if(!wb_service_cache_compact())
+			wi_log_warn(WI_STR("Could not compact service cache %@: %m"), path);
+	}
+	
+	wi_log_info(WI_STR("Service cache: %u entries in %@"), wb_service_cache_count, path);
+	
+	return true;
+}
+
+
+
+void wb_service_cache_close(void) {
+	wi_uinteger_t		i;
+	
+	if(wb_service_cache_fd >= 0) {
+		close(wb_service_cache_fd);
+		
+		wb_service_cache_fd = -1;
+	}
+	
+	for(i = 0; i < wb_service_cache_count; i++)
+		wi_release(wb_service_cache_entries[i].key);
+	
+	wi_free(wb_service_cache_entries);
+	
+	wb_service_cache_entries	= NULL;
+	wb_service_cache_count		= 0;
+	wb_service_cache_capacity	= 0;
+	wb_service_cache_records	= 0;
+	wb_service_cache_size		= 0;
+	
+	wi_release(wb_service_cache_index);
+	wb_service_cache_index = NULL;
+	
+	wi_release(wb_service_cache_path);
+	wb_service_cache_path = NULL;
+}
+
+
+
+#pragma mark -
+
+wb_service_cache_result_t wb_service_cache_lookup(wi_string_t *service, wi_string_t *query, wi_string_t **value) {
+	wb_service_cache_entry_t	*entry;
+	char						*buffer;
+	
+	if(wb_service_cache_fd < 0)
+		return WB_SERVICE_CACHE_MISS;
+	
+	entry = wb_service_cache_entry(wb_service_cache_key(service, query), false);
+	
+	if(!entry || entry->expires == 0) {
+		wb_service_cache_misses++;
+		
+		return WB_SERVICE_CACHE_MISS;
+	}
+	
+	if(entry->expires <= (int64_t) wi_time_interval()) {
+		entry->expires = 0;
+		
+		wb_service_cache_expired++;
+		wb_service_cache_misses++;
+		
+		return WB_SERVICE_CACHE_MISS;
+	}
+	
+	if(!entry->found) {
+		wb_service_cache_negative_hits++;
+		
+		return WB_SERVICE_CACHE_NOT_FOUND;
+	}
+	
+	buffer = wi_malloc(entry->length + 1);
+	
+	if(pread(wb_service_cache_fd, buffer, entry->length, entry->offset) != (ssize_t) entry->length) {
+		wi_free(buffer);
+		
+		wb_service_cache_misses++;
+		
+		return WB_SERVICE_CACHE_MISS;
+	}
+	
+	buffer[entry->length] = '\0';
+	
+	*value = wi_string_with_format(WI_STR("%s"), buffer);
+	
+	wi_free(buffer);
+	
+	wb_service_cache_hits++;
+	
+	return WB_SERVICE_CACHE_HIT;
+}
+
+
+
+void wb_service_cache_store(wi_string_t *service, wi_string_t *query, wi_string_t *value) {
+	wb_service_cache_entry_t	*entry;
+	wi_string_t					*key;
+	const char					*bytes;
+	off_t						offset;
+	uint32_t					length;
+	int64_t						expires;
+	
+	if(wb_service_cache_fd < 0)
+		return;
+	
+	bytes	= value ? wi_string_cstring(value) : "";
+	length	= strlen(bytes);
+	
+	if(length > WB_SERVICE_CACHE_MAX_LENGTH)
+		return;
+	
+	key		= wb_service_cache_key(service, query);
+	expires	= (int64_t) wi_time_interval() + wi_config_integer_for_name(wd_config,
+		value ? WI_STR("service cache ttl") : WI_STR("service cache negative ttl"));
+	
+	if(!wb_service_cache_append(wb_service_cache_fd, &wb_service_cache_size, key, bytes, length, (value != NULL), expires)) {
+		wi_log_warn(WI_STR("Could not write to service cache %@: %m"), wb_service_cache_path);
+		
+		return;
+	}
+	
+	offset	= wb_service_cache_size - length;
+	entry	= wb_service_cache_entry(key, true);
+	
+	entry->offset	= offset;
+	entry->length	= length;
+	entry->found	= (value != NULL);
+	entry->expires	= expires;
+	
+	wb_service_cache_records++;
+	
+	// a bot that is never restarted would otherwise grow the log forever
+	if(wb_service_cache_needs_compaction()) {
+		if(!wb_service_cache_compact())
+			wi_log_warn(WI_STR("Could not compact service cache %@: %m"), wb_service_cache_path);
+	}
+}
+
+
+
+void wb_service_cache_log_statistics(void) {
+	wi_uinteger_t		lookups;
+	
+	lookups = wb_service_cache_hits + wb_service_cache_negative_hits + wb_service_cache_misses;
+	
+	wi_log_info(WI_STR("Service cache: %u lookups, %u hits and %u not found hits (%.1f%%), %u misses of which %u expired, %u entries in %u records"),
+		lookups,
+		wb_service_cache_hits,
+		wb_service_cache_negative_hits,
+		lookups > 0 ? 100.0 * (wb_service_cache_hits + wb_service_cache_negative_hits) / lookups : 0.0,
+		wb_service_cache_misses,
+		wb_service_cache_expired,
+		wb_service_cache_count,
+		wb_service_cache_records);
+}
+
+
+
+#pragma mark -
+
+static wb_service_cache_state_t wb_service_cache_read(void) {
+	wb_service_cache_record_t	record;
+	wb_service_cache_entry_t	*entry;
+	char						magic[8], *key;
+	off_t						offset;
+	ssize_t						bytes;
+	struct stat					sb;
+	int							fd, error;
+	
+	fd = open(wi_string_cstring(wb_service_cache_path), O_RDWR | O_CREAT, 0600);
+	
+	if(fd < 0)
+		return WB_SERVICE_CACHE_FAILED;
+	
+	bytes = read(fd, magic, sizeof(magic));
+	
+	if(bytes < 0) {
+		error = errno;
+		close(fd);
+		errno = error;
+		
+		return WB_SERVICE_CACHE_FAILED;
+	}
+	
+	// only a file that does not start with the magic is corrupt
+	if(bytes == 0) {
+		if(write(fd, WB_SERVICE_CACHE_MAGIC, sizeof(magic)) != sizeof(magic)) {
+			error = errno;
+			close(fd);
+			errno = error;
+			
+			return WB_SERVICE_CACHE_FAILED;
+		}
+	}
+	else if(bytes != sizeof(magic) || memcmp(magic, WB_SERVICE_CACHE_MAGIC, sizeof(magic)) != 0) {
+		close(fd);
+		
+		return WB_SERVICE_CACHE_CORRUPT;
+	}
+	
+	if(fstat(fd, &sb) < 0) {
+		error = errno;
+		close(fd);
+		errno = error;
+		
+		return WB_SERVICE_CACHE_FAILED;
+	}
+	
+	key		= wi_malloc(WB_SERVICE_CACHE_MAX_LENGTH + 1);
+	offset	= sizeof(magic);
+	
+	while((bytes = pread(fd, &record, sizeof(record), offset)) == sizeof(record)) {
+		if(record.magic != WB_SERVICE_CACHE_RECORD_MAGIC ||
+		   record.key_length > WB_SERVICE_CACHE_MAX_LENGTH ||
+		   record.value_length > WB_SERVICE_CACHE_MAX_LENGTH)
+			break;
+		
+		bytes = pread(fd, key, record.key_length, offset + sizeof(record));
+		
+		if(bytes != (ssize_t) record.key_length)
+			break;
+		
+		// the value must be all there too
+		if(sb.st_size < offset + (off_t) (sizeof(record) + record.key_length + record.value_length))
+			break;
+		
+		key[record.key_length] = '\0';
+		
+		entry = wb_service_cache_entry(wi_string_with_format(WI_STR("%s"), key), true);
+		
+		entry->offset	= offset + sizeof(record) + record.key_length;
+		entry->length	= record.value_length;
+		entry->found	= record.found;
+		entry->expires	= record.expires;
+		
+		offset += sizeof(record) + record.key_length + record.value_length;
+		
+		wb_service_cache_records++;
+	}
+	
+	wi_free(key);
+	
+	// a failed read says nothing about the rest of the log, which must
+	// not be cut off
+	if(bytes < 0) {
+		error = errno;
+		close(fd);
+		errno = error;
+		
+		return WB_SERVICE_CACHE_FAILED;
+	}
+	
+	// cut off a record torn by a crash, so appends start clean
+	if(sb.st_size > offset && ftruncate(fd, offset) < 0) {
+		error = errno;
+		close(fd);
+		errno = error;
+		
+		return WB_SERVICE_CACHE_FAILED;
+	}
+	
+	wb_service_cache_fd		= fd;
+	wb_service_cache_size	= offset;
+	
+	return WB_SERVICE_CACHE_READ;
+}
+
+
+
+static wi_boolean_t wb_service_cache_needs_compaction(void) {
+	return (wb_service_cache_records > 64 && wb_service_cache_records > wb_service_cache_count * 2);
+}
+
+
+
+static wi_boolean_t wb_service_cache_compact(void) {
+	wb_service_cache_entry_t	*entry;
+	wi_string_t					*new_path;
+	char						*buffer;
+	off_t						size, *offsets;
+	int64_t						interval;
+	wi_uinteger_t				i;
+	int							fd;
+	
+	new_path	= wi_string_by_appending_string(wb_service_cache_path, WI_STR(".new"));
+	fd			= open(wi_string_cstring(new_path), O_WRONLY | O_CREAT | O_TRUNC, 0600);
+	
+	if(fd < 0)
+		return false;
+	
+	if(write(fd, WB_SERVICE_CACHE_MAGIC, 8) != 8) {
+		close(fd);
+		unlink(wi_string_cstring(new_path));
+		
+		return false;
+	}
+	
+	size		= 8;
+	interval	= (int64_t) wi_time_interval();
+	buffer		= wi_malloc(WB_SERVICE_CACHE_MAX_LENGTH + 1);
+	offsets		= wi_malloc(sizeof(off_t) * (wb_service_cache_count + 1));
+	
+	for(i = 0; i < wb_service_cache_count; i++) {
+		entry		= &wb_service_cache_entries[i];
+		offsets[i]	= -1;
+		
+		if(entry->expires <= interval)
+			continue;
+		
+		if(pread(wb_service_cache_fd, buffer, entry->length, entry->offset) != (ssize_t) entry->length ||
+		   !wb_service_cache_append(fd, &size, entry->key, buffer, entry->length, entry->found, entry->expires)) {
+			wi_free(offsets);
+			wi_free(buffer);
+			close(fd);
+			unlink(wi_string_cstring(new_path));
+			
+			return false;
+		}
+		
+		offsets[i] = size - entry->length;
+	}
+	
+	wi_free(buffer);
+	
+	if(fsync(fd) < 0 || rename(wi_string_cstring(new_path), wi_string_cstring(wb_service_cache_path)) < 0) {
+		wi_free(offsets);
+		close(fd);
+		unlink(wi_string_cstring(new_path));
+		
+		return false;
+	}
+	
+	close(wb_service_cache_fd);
+	close(fd);
+	
+	wb_service_cache_fd = open(wi_string_cstring(wb_service_cache_path), O_RDWR);
+	
+	if(wb_service_cache_fd < 0) {
+		wi_free(offsets);
+		
+		return false;
+	}
+	
+	// expired entries stay in the index as misses until they are stored again
+	wb_service_cache_records = 0;
+	
+	for(i = 0; i < wb_service_cache_count; i++) {
+		if(offsets[i] < 0) {
+			wb_service_cache_entries[i].expires = 0;
+		} else {
+			wb_service_cache_entries[i].offset = offsets[i];
+			
+			wb_service_cache_records++;
+		}
+	}
+	
+	wb_service_cache_size = size;
+	
+	wi_free(offsets);
+	
+	return true;
+}
+
+
+
+static wi_boolean_t wb_service_cache_append(int fd, off_t *size, wi_string_t *key, const char *value, uint32_t length, uint32_t found, int64_t expires) {
+	wb_service_cache_record_t	record;
+	const char					*key_bytes;
+	char						*buffer;
+	size_t						buffer_size;
+	ssize_t						bytes;
+	
+	key_bytes			= wi_string_cstring(key);
+	
+	record.magic		= WB_SERVICE_CACHE_RECORD_MAGIC;
+	record.key_length	= strlen(key_bytes);
+	record.value_length	= length;
+	record.found		= found;
+	record.expires		= expires;
+	
+	// one write for the whole record, so it lands in one piece
+	buffer_size	= sizeof(record) + record.key_length + length;
+	buffer		= wi_malloc(buffer_size);
+	
+	memcpy(buffer, &record, sizeof(record));
+	memcpy(buffer + sizeof(record), key_bytes, record.key_length);
+	memcpy(buffer + sizeof(record) + record.key_length, value, length);
+	
+	bytes = pwrite(fd, buffer, buffer_size, *size);
+	
+	wi_free(buffer);
+	
+	if(bytes != (ssize_t) buffer_size)
+		return false;
+	
+	*size += buffer_size;
+	
+	return true;
+}
+
+
+
+static wb_service_cache_entry_t * wb_service_cache_entry(wi_string_t *key, wi_boolean_t create) {
+	wb_service_cache_entry_t	*entry;
+	wi_uinteger_t				index;
+	
+	index = (wi_uinteger_t) (intptr_t) wi_dictionary_data_for_key(wb_service_cache_index, key);
+	
+	if(index > 0)
+		return &wb_service_cache_entries[index - 1];
+	
+	if(!create)
+		return NULL;
+	
+	if(wb_service_cache_count == wb_service_cache_capacity) {
+		wb_service_cache_capacity	= wb_service_cache_capacity > 0 ? wb_service_cache_capacity * 2 : 64;
+		wb_service_cache_entries	= wi_realloc(wb_service_cache_entries, wb_service_cache_capacity * sizeof(wb_service_cache_entry_t));
+	}
+	
+	entry = &wb_service_cache_entries[wb_service_cache_count++];
+	
+	memset(entry, 0, sizeof(wb_service_cache_entry_t));
+	
+	entry->key = wi_retain(key);
+	
+	wi_mutable_dictionary_set_data_for_key(wb_service_cache_index, (void *) (intptr_t) wb_service_cache_count, key);
+	
+	return entry;
+}
+
+
+
+static wi_string_t * wb_service_cache_key(wi_string_t *service, wi_string_t *query) {
+	wi_mutable_string_t		*key;
+	const char				*p;
+	wi_boolean_t			space;
+	
+	// case and runs of blanks do not make a different title
+	key		= wi_mutable_string_with_format(WI_STR("%@\t"), service);
+	space	= false;
+	
+	for(p = wi_string_cstring(wi_string_lowercase_string(query)); *p; p++) {
+		if(*p == ' ' || *p == '\t' || *p == '_') {
+			space = true;
+			
+			continue;
+		}
+		
+		if(space && wi_string_length(key) > wi_string_length(service) + 1)
+			wi_mutable_string_append_string(key, WI_STR(" "));
+		
+		space = false;
+		
+		wi_mutable_string_append_format(key, WI_STR("%c"), *p);
+	}
+	
+	return key;
+}
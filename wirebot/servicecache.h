@@ -0,0 +1,53 @@
+/* $Id$ */
+
+/*
+ *  Copyright (c) 2012 Rafael Warnault
+ *  All rights reserved.
+ * 
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef WR_SERVICECACHE_H
+#define WR_SERVICECACHE_H 1
+
+#include <wired/wired.h>
+
+/**
+ * What the cache knows of a lookup
+ */
+enum _wb_service_cache_result {
+	WB_SERVICE_CACHE_MISS			= 0,
+	WB_SERVICE_CACHE_HIT,
+	WB_SERVICE_CACHE_NOT_FOUND
+};
+typedef enum _wb_service_cache_result	wb_service_cache_result_t;
+
+
+wi_boolean_t							wb_service_cache_open(wi_string_t *);
+void									wb_service_cache_close(void);
+
+wb_service_cache_result_t				wb_service_cache_lookup(wi_string_t *, wi_string_t *, wi_string_t **);
+void									wb_service_cache_store(wi_string_t *, wi_string_t *, wi_string_t *);
+
+void									wb_service_cache_log_statistics(void);
+
+#endif /* WR_SERVICECACHE_H */
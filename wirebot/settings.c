@@ -52,6 +52,7 @@ void wd_settings_initialize(void) {
 		WI_INT32(WI_CONFIG_STRING),				WI_STR("password"),
 		WI_INT32(WI_CONFIG_STRING),				WI_STR("hostname"),
 		WI_INT32(WI_CONFIG_PORT),				WI_STR("port"),
+		WI_INT32(WI_CONFIG_STRINGLIST),			WI_STR("server"),
 		WI_INT32(WI_CONFIG_STRING),				WI_STR("nick"),
 		WI_INT32(WI_CONFIG_STRING),				WI_STR("status"),
 		WI_INT32(WI_CONFIG_PATH),				WI_STR("icon path"),
@@ -59,6 +60,26 @@ void wd_settings_initialize(void) {
 		WI_INT32(WI_CONFIG_BOOL),				WI_STR("auto reconnect"),
 		WI_INT32(WI_CONFIG_BOOL),				WI_STR("reconnect on kick"),
 		WI_INT32(WI_CONFIG_STRING),				WI_STR("omdb api key"),
+		WI_INT32(WI_CONFIG_INTEGER),			WI_STR("service timeout"),
+		WI_INT32(WI_CONFIG_INTEGER),			WI_STR("service connect timeout"),
+		WI_INT32(WI_CONFIG_INTEGER),			WI_STR("service lookups"),
+		WI_INT32(WI_CONFIG_PATH),				WI_STR("service cache path"),
+		WI_INT32(WI_CONFIG_INTEGER),			WI_STR("service cache ttl"),
+		WI_INT32(WI_CONFIG_INTEGER),			WI_STR("service cache negative ttl"),
+		WI_INT32(WI_CONFIG_INTEGER),			WI_STR("ping interval"),
+		WI_INT32(WI_CONFIG_INTEGER),			WI_STR("ping timeout"),
+		WI_INT32(WI_CONFIG_BOOL),				WI_STR("tcp keepalive"),
+		WI_INT32(WI_CONFIG_INTEGER),			WI_STR("tcp user timeout"),
+		WI_INT32(WI_CONFIG_BOOL),				WI_STR("compression"),
+		WI_INT32(WI_CONFIG_STRING),				WI_STR("cipher"),
+		WI_INT32(WI_CONFIG_STRING),				WI_STR("checksum"),
+		WI_INT32(WI_CONFIG_BOOL),				WI_STR("transport instrumentation"),
+		WI_INT32(WI_CONFIG_PATH),				WI_STR("seen path"),
+		WI_INT32(WI_CONFIG_INTEGER),			WI_STR("watcher debounce"),
+		WI_INT32(WI_CONFIG_INTEGER),			WI_STR("watcher max delay"),
+		WI_INT32(WI_CONFIG_INTEGER),			WI_STR("watcher listings"),
+		WI_INT32(WI_CONFIG_INTEGER),			WI_STR("watcher stable time"),
+		WI_INT32(WI_CONFIG_PATH),				WI_STR("snapshot path"),
 		NULL);
 	
 	defaults = wi_dictionary_with_data_and_keys(
@@ -73,6 +94,26 @@ void wd_settings_initialize(void) {
 		wi_number_with_bool(true),				WI_STR("auto reconnect"),
 		wi_number_with_bool(false),				WI_STR("reconnect on kick"),
 		WI_STR(""),										WI_STR("omdb api key"),
+		WI_INT32(10),							WI_STR("service timeout"),
+		WI_INT32(5),							WI_STR("service connect timeout"),
+		WI_INT32(2),							WI_STR("service lookups"),
+		WI_STR("services.cache"),				WI_STR("service cache path"),
+		WI_INT32(604800),						WI_STR("service cache ttl"),
+		WI_INT32(86400),						WI_STR("service cache negative ttl"),
+		WI_INT32(10),							WI_STR("ping interval"),
+		WI_INT32(5),							WI_STR("ping timeout"),
+		wi_number_with_bool(true),				WI_STR("tcp keepalive"),
+		WI_INT32(10),							WI_STR("tcp user timeout"),
+		wi_number_with_bool(true),				WI_STR("compression"),
+		WI_STR("aes256"),						WI_STR("cipher"),
+		WI_STR("sha1"),							WI_STR("checksum"),
+		wi_number_with_bool(false),				WI_STR("transport instrumentation"),
+		WI_STR("seen.db"),						WI_STR("seen path"),
+		WI_INT32(2),							WI_STR("watcher debounce"),
+		WI_INT32(10),							WI_STR("watcher max delay"),
+		WI_INT32(4),							WI_STR("watcher listings"),
+		WI_INT32(5),							WI_STR("watcher stable time"),
+		WI_STR("snapshots"),					WI_STR("snapshot path"),
 		NULL);
 	
 	wd_config = wi_config_init_with_path(wi_config_alloc(), wr_config_path, types, defaults);
@@ -100,6 +141,26 @@ wi_boolean_t wd_settings_read_config(void) {
 		wi_config_note_change(wd_config, WI_STR("auto reconnect"));
 		wi_config_note_change(wd_config, WI_STR("reconnect on kick"));
 		wi_config_note_change(wd_config, WI_STR("omdb api key"));
+		wi_config_note_change(wd_config, WI_STR("service timeout"));
+		wi_config_note_change(wd_config, WI_STR("service connect timeout"));
+		wi_config_note_change(wd_config, WI_STR("service lookups"));
+		wi_config_note_change(wd_config, WI_STR("service cache path"));
+		wi_config_note_change(wd_config, WI_STR("service cache ttl"));
+		wi_config_note_change(wd_config, WI_STR("service cache negative ttl"));
+		wi_config_note_change(wd_config, WI_STR("ping interval"));
+		wi_config_note_change(wd_config, WI_STR("ping timeout"));
+		wi_config_note_change(wd_config, WI_STR("tcp keepalive"));
+		wi_config_note_change(wd_config, WI_STR("tcp user timeout"));
+		wi_config_note_change(wd_config, WI_STR("compression"));
+		wi_config_note_change(wd_config, WI_STR("cipher"));
+		wi_config_note_change(wd_config, WI_STR("checksum"));
+		wi_config_note_change(wd_config, WI_STR("transport instrumentation"));
+		wi_config_note_change(wd_config, WI_STR("seen path"));
+		wi_config_note_change(wd_config, WI_STR("watcher debounce"));
+		wi_config_note_change(wd_config, WI_STR("watcher max delay"));
+		wi_config_note_change(wd_config, WI_STR("watcher listings"));
+		wi_config_note_change(wd_config, WI_STR("watcher stable time"));
+		wi_config_note_change(wd_config, WI_STR("snapshot path"));
 		
 		result = wi_config_write_file(wd_config);
 	} else {
@@ -0,0 +1,432 @@
+/* $Id$ */
+
+/*
+ *  Copyright (c) 2012 Rafael Warnault
+ *  All rights reserved.
+ * 
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "config.h"
+
+#include <sys/types.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <wired/wired.h>
+
+#include "snapshot.h"
+
+/*
+	Snapshots of watched directories, so changes made while the bot was
+	away can be announced when it lists them again. Each directory has its
+	own file named after a hash of its path, holding one fixed size record
+	per file: a 64-bit hash of the path, the data size and the modification
+	time, sorted by hash. A file of 100k entries takes 2.4 MB and is mapped
+	read-only and binary searched, nothing is parsed at startup.
+	
+	Records of a listing are collected while it comes in, and the file is
+	replaced when the listing is done: the new snapshot is written next to
+	the old one and renamed over it. Files a watcher still holds back are
+	left out, so they are announced after a restart if it came first.
+*/
+
+#define WB_SNAPSHOT_MAGIC				"WBSNAP01"
+
+struct _wb_snapshot_header {
+	char							magic[8];
+	uint32_t						record_size;
+	uint32_t						reserved;
+	uint64_t						count;
+	uint64_t						directory;
+	int64_t							time;
+	char							padding[24];
+};
+typedef struct _wb_snapshot_header	wb_snapshot_header_t;
+
+struct _wb_snapshot_record {
+	uint64_t						key;
+	uint64_t						size;
+	int64_t							mtime;
+};
+typedef struct _wb_snapshot_record	wb_snapshot_record_t;
+
+struct _wb_snapshot {
+	wi_runtime_base_t				base;
+	
+	wi_string_t						*directory;
+	
+	wb_snapshot_header_t			*header;
+	wb_snapshot_record_t			*old_records;
+	size_t							size;
+	
+	wb_snapshot_record_t			*records;
+	wi_uinteger_t					count;
+	wi_uinteger_t					capacity;
+	wi_uinteger_t					matched;
+};
+typedef struct _wb_snapshot			wb_snapshot_t;
+
+
+static wb_snapshot_t *				wb_snapshot_with_directory(wi_string_t *);
+static void							wb_snapshot_dealloc(wi_runtime_instance_t *);
+static void							wb_snapshot_map(wb_snapshot_t *);
+static void							wb_snapshot_drop_records(wb_snapshot_t *, wi_array_t *);
+static wi_boolean_t					wb_snapshot_write(wb_snapshot_t *);
+static wi_string_t *				wb_snapshot_path(wi_string_t *);
+static uint64_t						wb_snapshot_key(wi_string_t *);
+static int							wb_snapshot_compare(const void *, const void *);
+
+
+static wi_string_t					*wb_snapshots_path;
+static wi_mutable_dictionary_t		*wb_snapshots;
+
+static wi_runtime_id_t				wb_snapshot_runtime_id = WI_RUNTIME_ID_NULL;
+static wi_runtime_class_t			wb_snapshot_runtime_class = {
+	"wb_snapshot_t",
+	wb_snapshot_dealloc,
+	NULL,
+	NULL,
+	NULL,
+	NULL
+};
+
+
+
+#pragma mark -
+
+wi_boolean_t wb_snapshots_open(wi_string_t *path) {
+	wb_snapshots_close();
+	
+	if(wb_snapshot_runtime_id == WI_RUNTIME_ID_NULL)
+		wb_snapshot_runtime_id = wi_runtime_register_class(&wb_snapshot_runtime_class);
+	
+	if(mkdir(wi_string_cstring(path), 0700) < 0 && errno != EEXIST) {
+		wi_log_error(WI_STR("Could not create snapshot directory %@: %m"), path);
+		
+		return false;
+	}
+	
+	wb_snapshots_path	= wi_retain(path);
+	wb_snapshots		= wi_dictionary_init(wi_mutable_dictionary_alloc());
+	
+	return true;
+}
+
+
+
+void wb_snapshots_close(void) {
+	wi_release(wb_snapshots);
+	wb_snapshots = NULL;
+	
+	wi_release(wb_snapshots_path);
+	wb_snapshots_path = NULL;
+}
+
+
+
+#pragma mark -
+
+wb_snapshot_change_t wb_snapshots_note_file(wi_string_t *directory, wi_string_t *path, uint64_t size, wi_time_interval_t mtime) {
+	wb_snapshot_t			*snapshot;
+	wb_snapshot_record_t	*record, *old_record;
+	
+	if(!wb_snapshots)
+		return WB_SNAPSHOT_UNKNOWN;
+	
+	snapshot = wi_dictionary_data_for_key(wb_snapshots, directory);
+	
+	if(!snapshot) {
+		snapshot = wb_snapshot_with_directory(directory);
+		
+		wi_mutable_dictionary_set_data_for_key(wb_snapshots, snapshot, directory);
+	}
+	
+	if(snapshot->count == snapshot->capacity) {
+		snapshot->capacity	= snapshot->capacity > 0 ? snapshot->capacity * 2 : 256;
+		snapshot->records	= wi_realloc(snapshot->records, snapshot->capacity * sizeof(wb_snapshot_record_t));
+	}
+	
+	record			= &snapshot->records[snapshot->count++];
+	record->key		= wb_snapshot_key(path);
+	record->size	= size;
+	record->mtime	= (int64_t) mtime;
+	
+	if(!snapshot->header)
+		return WB_SNAPSHOT_UNKNOWN;
+	
+	old_record = bsearch(record, snapshot->old_records, snapshot->header->count,
+		sizeof(wb_snapshot_record_t), wb_snapshot_compare);
+	
+	if(!old_record)
+		return WB_SNAPSHOT_ADDED;
+	
+	snapshot->matched++;
+	
+	if(old_record->size != record->size || old_record->mtime != record->mtime)
+		return WB_SNAPSHOT_MODIFIED;
+	
+	return WB_SNAPSHOT_UNCHANGED;
+}
+
+
+
+wi_integer_t wb_snapshots_note_done(wi_string_t *directory, wi_array_t *held) {
+	wb_snapshot_t			*snapshot;
+	wi_integer_t			removed;
+	
+	if(!wb_snapshots)
+		return -1;
+	
+	snapshot = wi_dictionary_data_for_key(wb_snapshots, directory);
+	
+	// an empty listing sends no entries at all
+	if(!snapshot)
+		snapshot = wb_snapshot_with_directory(directory);
+	
+	removed = snapshot->header ? (wi_integer_t) (snapshot->header->count - snapshot->matched) : -1;
+	
+	if(held && wi_array_count(held) > 0)
+		wb_snapshot_drop_records(snapshot, held);
+	
+	wb_snapshot_write(snapshot);
+	
+	wi_mutable_dictionary_remove_data_for_key(wb_snapshots, directory);
+	
+	return removed;
+}
+
+
+
+void wb_snapshots_note_error(wi_string_t *directory) {
+	// the listing failed part way, the old snapshot stays valid
+	if(wb_snapshots)
+		wi_mutable_dictionary_remove_data_for_key(wb_snapshots, directory);
+}
+
+
+
+void wb_snapshots_discard(void) {
+	// listings cut short are not written, the old snapshots stay valid
+	if(wb_snapshots)
+		wi_mutable_dictionary_remove_all_data(wb_snapshots);
+}
+
+
+
+#pragma mark -
+
+static wb_snapshot_t * wb_snapshot_with_directory(wi_string_t *directory) {
+	wb_snapshot_t		*snapshot;
+	
+	snapshot				= wi_runtime_create_instance(wb_snapshot_runtime_id, sizeof(wb_snapshot_t));
+	snapshot->directory		= wi_copy(directory);
+	
+	wb_snapshot_map(snapshot);
+	
+	return wi_autorelease(snapshot);
+}
+
+
+
+static void wb_snapshot_dealloc(wi_runtime_instance_t *instance) {
+	wb_snapshot_t		*snapshot = instance;
+	
+	if(snapshot->header)
+		munmap(snapshot->header, snapshot->size);
+	
+	if(snapshot->records)
+		wi_free(snapshot->records);
+	
+	wi_release(snapshot->directory);
+}
+
+
+
+static void wb_snapshot_map(wb_snapshot_t *snapshot) {
+	wb_snapshot_header_t	*header;
+	wi_string_t				*path;
+	struct stat				sb;
+	void					*map;
+	int						fd;
+	
+	path	= wb_snapshot_path(snapshot->directory);
+	fd		= open(wi_string_cstring(path), O_RDONLY);
+	
+	if(fd < 0)
+		return;
+	
+	if(fstat(fd, &sb) < 0 || (size_t) sb.st_size < sizeof(wb_snapshot_header_t)) {
+		close(fd);
+		
+		return;
+	}
+	
+	map = mmap(NULL, sb.st_size, PROT_READ, MAP_SHARED, fd, 0);
+	
+	close(fd);
+	
+	if(map == MAP_FAILED)
+		return;
+	
+	header = map;
+	
+	if(memcmp(header->magic, WB_SNAPSHOT_MAGIC, sizeof(header->magic)) != 0 ||
+	   header->record_size != sizeof(wb_snapshot_record_t) ||
+	   header->directory != wb_snapshot_key(snapshot->directory) ||
+	   (size_t) sb.st_size != sizeof(wb_snapshot_header_t) + header->count * sizeof(wb_snapshot_record_t)) {
+		wi_log_warn(WI_STR("Ignoring invalid snapshot %@ of %@"), path, snapshot->directory);
+		
+		munmap(map, sb.st_size);
+		
+		return;
+	}
+	
+	snapshot->header		= header;
+	snapshot->old_records	= (wb_snapshot_record_t *) (header + 1);
+	snapshot->size			= sb.st_size;
+}
+
+
+
+static void wb_snapshot_drop_records(wb_snapshot_t *snapshot, wi_array_t *paths) {
+	wb_snapshot_record_t	*keys, *record;
+	wi_uinteger_t			i, j, count;
+	
+	count	= wi_array_count(paths);
+	keys	= wi_malloc(count * sizeof(wb_snapshot_record_t));
+	
+	for(i = 0; i < count; i++)
+		keys[i].key = wb_snapshot_key(WI_ARRAY(paths, i));
+	
+	qsort(keys, count, sizeof(wb_snapshot_record_t), wb_snapshot_compare);
+	
+	for(i = j = 0; i < snapshot->count; i++) {
+		record = &snapshot->records[i];
+		
+		if(bsearch(record, keys, count, sizeof(wb_snapshot_record_t), wb_snapshot_compare))
+			continue;
+		
+		snapshot->records[j++] = *record;
+	}
+	
+	snapshot->count = j;
+	
+	wi_free(keys);
+}
+
+
+
+static wi_boolean_t wb_snapshot_write(wb_snapshot_t *snapshot) {
+	wb_snapshot_header_t	header;
+	wi_string_t				*path, *new_path;
+	size_t					size;
+	int						fd;
+	
+	path		= wb_snapshot_path(snapshot->directory);
+	new_path	= wi_string_by_appending_string(path, WI_STR(".new"));
+	
+	if(snapshot->count > 0)
+		qsort(snapshot->records, snapshot->count, sizeof(wb_snapshot_record_t), wb_snapshot_compare);
+	
+	memset(&header, 0, sizeof(header));
+	memcpy(header.magic, WB_SNAPSHOT_MAGIC, sizeof(header.magic));
+	
+	header.record_size	= sizeof(wb_snapshot_record_t);
+	header.count		= snapshot->count;
+	header.directory	= wb_snapshot_key(snapshot->directory);
+	header.time			= (int64_t) wi_time_interval();
+	
+	size	= snapshot->count * sizeof(wb_snapshot_record_t);
+	fd		= open(wi_string_cstring(new_path), O_WRONLY | O_CREAT | O_TRUNC, 0600);
+	
+	if(fd < 0)
+		goto error;
+	
+	if(write(fd, &header, sizeof(header)) != (ssize_t) sizeof(header) ||
+	   (size > 0 && write(fd, snapshot->records, size) != (ssize_t) size) ||
+	   fsync(fd) < 0) {
+		close(fd);
+		unlink(wi_string_cstring(new_path));
+		
+		goto error;
+	}
+	
+	close(fd);
+	
+	// the new snapshot must be complete on disk before it replaces the old one
+	if(rename(wi_string_cstring(new_path), wi_string_cstring(path)) < 0) {
+		unlink(wi_string_cstring(new_path));
+		
+		goto error;
+	}
+	
+	return true;
+	
+error:
+	wi_log_error(WI_STR("Could not write snapshot of %@ to %@: %m"), snapshot->directory, path);
+	
+	return false;
+}
+
+
+
+static wi_string_t * wb_snapshot_path(wi_string_t *directory) {
+	return wi_string_by_appending_path_component(wb_snapshots_path,
+		wi_string_with_format(WI_STR("%016llx.snapshot"), (unsigned long long) wb_snapshot_key(directory)));
+}
+
+
+
+static uint64_t wb_snapshot_key(wi_string_t *path) {
+	const unsigned char		*p;
+	uint64_t				key;
+	
+	// FNV-1a
+	key = 14695981039346656037ULL;
+	
+	for(p = (const unsigned char *) wi_string_cstring(path); *p; p++) {
+		key ^= *p;
+		key *= 1099511628211ULL;
+	}
+	
+	return key;
+}
+
+
+
+static int wb_snapshot_compare(const void *p1, const void *p2) {
+	const wb_snapshot_record_t	*record1 = p1, *record2 = p2;
+	
+	if(record1->key < record2->key)
+		return -1;
+	else if(record1->key > record2->key)
+		return 1;
+	
+	return 0;
+}
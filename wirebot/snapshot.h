@@ -0,0 +1,55 @@
+/* $Id$ */
+
+/*
+ *  Copyright (c) 2012 Rafael Warnault
+ *  All rights reserved.
+ * 
+ *  Redistribution and use in source and binary forms, with or without
+ *  modification, are permitted provided that the following conditions
+ *  are met:
+ *  1. Redistributions of source code must retain the above copyright
+ *     notice, this list of conditions and the following disclaimer.
+ *  2. Redistributions in binary form must reproduce the above copyright
+ *     notice, this list of conditions and the following disclaimer in the
+ *     documentation and/or other materials provided with the distribution.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR ``AS IS'' AND ANY EXPRESS OR
+ * IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+ * SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT,
+ * STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN
+ * ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef WR_SNAPSHOT_H
+#define WR_SNAPSHOT_H 1
+
+#include <stdint.h>
+#include <wired/wired.h>
+
+/**
+ * How a listed file compares to the last snapshot of its directory
+ */
+enum _wb_snapshot_change {
+	WB_SNAPSHOT_UNKNOWN				= 0,
+	WB_SNAPSHOT_UNCHANGED,
+	WB_SNAPSHOT_ADDED,
+	WB_SNAPSHOT_MODIFIED
+};
+typedef enum _wb_snapshot_change	wb_snapshot_change_t;
+
+
+wi_boolean_t						wb_snapshots_open(wi_string_t *);
+void								wb_snapshots_close(void);
+
+wb_snapshot_change_t				wb_snapshots_note_file(wi_string_t *, wi_string_t *, uint64_t, wi_time_interval_t);
+wi_integer_t						wb_snapshots_note_done(wi_string_t *, wi_array_t *);
+void								wb_snapshots_note_error(wi_string_t *);
+void								wb_snapshots_discard(void);
+
+#endif /* WR_SNAPSHOT_H */
@@ -36,7 +36,26 @@ wi_p7_spec_t				*wr_p7_spec;
 
 
 void wr_spec_init(void) {
+	wi_time_interval_t		interval;
+	
+	if(wr_p7_spec)
+		return;
+	
+	interval = wi_time_interval();
+	
+	// libwired only builds a wi_p7_spec_t from XML and keeps its layout
+	// private, so there is no binary snapshot to load here: wired.xml.h is
+	// run/wired.xml with the documentation and indentation stripped by the
+	// Makefile, which is what keeps this parse short
 	wr_p7_spec = wi_p7_spec_init_with_string(wi_p7_spec_alloc(), wi_string_with_cstring(
 #include "wired.xml.h"
 	), WI_P7_CLIENT);
+	
+	if(!wr_p7_spec)
+		wi_log_fatal(WI_STR("Could not load protocol specification: %m"));
+	
+	wi_log_debug(WI_STR("Loaded protocol %@ %@ in %.3f seconds"),
+		wi_p7_spec_name(wr_p7_spec),
+		wi_p7_spec_version(wr_p7_spec),
+		wi_time_interval() - interval);
 }
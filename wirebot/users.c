@@ -34,22 +34,40 @@
 #include <readline/readline.h>
 #include <wired/wired.h>
 
+#include "chats.h"
+#include "connection.h"
+#include "intmap.h"
 #include "users.h"
 #include "windows.h"
 
+/*
+	Users are shared: a connection keeps one wr_user_t per uid and every
+	chat the user is in only holds a reference to it in its uid table.
+	Statuses repeat a lot across a large server, so they are interned and
+	users point at one shared string each. Logins and addresses only come
+	with wired.user.info, which /info prints without keeping, so they stay
+	NULL. Flags and color are packed next to the uid.
+	
+	On LP64 the fields below take 40 bytes after the runtime header. Each
+	user also owns its nick string and takes one uid table slot in the
+	connection and in every chat it is in. There is no per-user target:
+	the total with allocator overhead has not been measured.
+*/
+
+#define WR_USERS_STRINGS_MAX			4096
+
 struct _wr_user {
 	wi_runtime_base_t				base;
 	
-	wr_uid_t						uid;
-	wi_boolean_t					idle;
-	wi_boolean_t					admin;
+	uint32_t						uid;
+	uint8_t							color;
+	unsigned int					idle:1;
+	unsigned int					admin:1;
 	
 	wi_string_t						*nick;
 	wi_string_t						*login;
 	wi_string_t						*status;
 	wi_string_t						*ip;
-	
-	wr_user_color_t					color;
 };
 
 
@@ -58,6 +76,12 @@ static wi_boolean_t					wr_user_is_equal(wi_runtime_instance_t *, wi_runtime_ins
 static wi_string_t *				wr_user_description(wi_runtime_instance_t *);
 static wi_hash_code_t				wr_user_hash(wi_runtime_instance_t *);
 
+static void							wr_user_set_values_with_message(wr_user_t *, wi_p7_message_t *);
+static wi_string_t *				wr_users_intern_string(wi_string_t *);
+
+
+static wi_mutable_dictionary_t		*wr_users_strings;
+
 
 static wi_runtime_id_t				wr_user_runtime_id = WI_RUNTIME_ID_NULL;
 static wi_runtime_class_t			wr_user_runtime_class = {
@@ -77,6 +101,53 @@ void wr_users_init(void) {
 
 
 void wr_users_clear(void) {
+	// users keep the strings they point at, only the sharing starts over
+	if(wr_users_strings)
+		wi_mutable_dictionary_remove_all_data(wr_users_strings);
+}
+
+
+
+#pragma mark -
+
+wr_user_t * wr_users_user_with_message(wi_p7_message_t *message) {
+	wr_user_t			*user;
+	wi_string_t			*nick;
+	wi_p7_uint32_t		uid;
+	
+	wi_p7_message_get_uint32_for_name(message, &uid, WI_STR("wired.user.id"));
+	
+	user = wr_intmap_data_for_key(wr_connection->users, uid);
+	
+	if(!user) {
+		user = wr_user_with_message(message);
+		
+		wr_intmap_set_data_for_key(wr_connection->users, user, uid);
+		
+		return user;
+	}
+	
+	// already known from another chat, refresh the shared user in place
+	nick = wi_p7_message_string_for_name(message, WI_STR("wired.user.nick"));
+	
+	if(nick && !wi_is_equal(nick, user->nick))
+		wr_chats_rename_user(user, nick);
+	
+	wr_user_set_values_with_message(user, message);
+	
+	return user;
+}
+
+
+
+void wr_users_remove_user(wr_user_t *user) {
+	wr_intmap_remove_data_for_key(wr_connection->users, user->uid);
+}
+
+
+
+wr_user_t * wr_users_user_with_uid(wr_uid_t uid) {
+	return wr_intmap_data_for_key(wr_connection->users, uid);
 }
 
 
@@ -135,26 +206,37 @@ wr_user_t * wr_user_alloc(void) {
 
 wr_user_t * wr_user_init_with_message(wr_user_t *user, wi_p7_message_t *message) {
 	wi_p7_uint32_t		uid;
-	wi_p7_boolean_t		idle, admin;
-	wi_p7_enum_t		color;
 	
 	wi_p7_message_get_uint32_for_name(message, &uid, WI_STR("wired.user.id"));
-	wi_p7_message_get_bool_for_name(message, &idle, WI_STR("wired.user.idle"));
-	wi_p7_message_get_bool_for_name(message, &admin, WI_STR("wired.user.admin"));
-	wi_p7_message_get_enum_for_name(message, &color, WI_STR("wired.account.color"));
 	
 	user->nick		= wi_retain(wi_p7_message_string_for_name(message, WI_STR("wired.user.nick")));
-	user->status	= wi_retain(wi_p7_message_string_for_name(message, WI_STR("wired.user.status")));
 	user->uid		= uid;
-	user->idle		= idle;
-	user->admin		= admin;
-	user->color		= color;
+	
+	wr_user_set_values_with_message(user, message);
 
 	return user;
 }
 
 
 
+static void wr_user_set_values_with_message(wr_user_t *user, wi_p7_message_t *message) {
+	wi_p7_boolean_t		idle, admin;
+	wi_p7_enum_t		color;
+	
+	if(wi_p7_message_get_bool_for_name(message, &idle, WI_STR("wired.user.idle")))
+		user->idle = idle;
+	
+	if(wi_p7_message_get_bool_for_name(message, &admin, WI_STR("wired.user.admin")))
+		user->admin = admin;
+	
+	if(wi_p7_message_get_enum_for_name(message, &color, WI_STR("wired.account.color")))
+		user->color = color;
+	
+	wr_user_set_status(user, wi_p7_message_string_for_name(message, WI_STR("wired.user.status")));
+}
+
+
+
 static void wr_user_dealloc(wi_runtime_instance_t *instance) {
 	wr_user_t		*user = instance;
 	
@@ -250,6 +332,8 @@ wi_string_t * wr_user_login(wr_user_t *user) {
 
 
 void wr_user_set_status(wr_user_t *user, wi_string_t *status) {
+	status = wr_users_intern_string(status);
+	
 	wi_retain(status);
 	wi_release(user->status);
 	
@@ -267,3 +351,30 @@ wi_string_t * wr_user_status(wr_user_t *user) {
 wr_user_color_t wr_user_color(wr_user_t *user) {
 	return user->color;
 }
+
+
+
+#pragma mark -
+
+static wi_string_t * wr_users_intern_string(wi_string_t *string) {
+	wi_string_t		*interned;
+	
+	if(!string)
+		return NULL;
+	
+	if(!wr_users_strings)
+		wr_users_strings = wi_dictionary_init(wi_mutable_dictionary_alloc());
+	
+	interned = wi_dictionary_data_for_key(wr_users_strings, string);
+	
+	if(interned)
+		return interned;
+	
+	// statuses are free text, do not let the pool grow without bound
+	if(wi_dictionary_count(wr_users_strings) >= WR_USERS_STRINGS_MAX)
+		wi_mutable_dictionary_remove_all_data(wr_users_strings);
+	
+	wi_mutable_dictionary_set_data_for_key(wr_users_strings, string, string);
+	
+	return string;
+}
@@ -50,6 +50,10 @@ void								wr_users_clear(void);
 
 char *								wr_readline_nickname_generator(const char *, int);
 
+wr_user_t *							wr_users_user_with_message(wi_p7_message_t *);
+wr_user_t *							wr_users_user_with_uid(wr_uid_t);
+void								wr_users_remove_user(wr_user_t *);
+
 wr_user_t *							wr_user_with_message(wi_p7_message_t *);
 
 wr_user_t *							wr_user_alloc(void);
@@ -34,8 +34,12 @@
 #include "settings.h"
 #include "service.h"
 #include "commands.h"
+#include "files.h"
+#include "filetable.h"
+#include "listings.h"
 #include <wired/wired.h>
 #include <string.h>
+#include <sys/resource.h>
 
 #pragma mark -
 
@@ -43,13 +47,47 @@ struct _wb_watcher {
 	wi_runtime_base_t				base;
 
 	wi_boolean_t					activated;
+	wi_boolean_t					recursive;
+	wi_boolean_t					armed;
 	wi_string_t						*path;
 	wi_string_t						*type;
 	wi_mutable_array_t				*services;
 	wi_mutable_array_t				*outputs;
-
-	wi_mutable_array_t 				*files;
-	wi_mutable_array_t 				*new_files;
+	wi_mutable_array_t				*summaries;
+
+	// outputs for files changed or removed after they were announced,
+	// sent as the listing finds them
+	wi_mutable_array_t				*modified_outputs;
+	wi_mutable_array_t				*removed_outputs;
+
+	// added files are held for the coalescing window, then announced in
+	// one summary, or one by one at most rate files a minute
+	wi_time_interval_t				window;
+	wi_uinteger_t					names;
+	wi_uinteger_t					rate;
+	wi_mutable_array_t				*announcements;
+	wi_file_offset_t				announcements_size;
+	wi_time_interval_t				announce_time;
+
+	// one table of file records per directory, so a recursive watcher
+	// can diff one directory of its tree without touching the others
+	wi_mutable_dictionary_t 		*files;
+
+	// new files held back until their size settles, in listing order
+	wi_mutable_dictionary_t 		*pending_files;
+
+	// directories below the path found by a recursive watcher
+	wi_mutable_set_t				*directories;
+
+	wi_uinteger_t					files_count;
+	wi_uinteger_t					files_bytes;
+	wi_uinteger_t					pending_count;
+
+	wi_uinteger_t					relists;
+	wi_time_interval_t				relist_time;
+	wi_uinteger_t					peak_entries;
+	wi_uinteger_t					peak_bytes;
+	long							peak_rss;
 };  
 
 static void							wb_watcher_dealloc(wi_runtime_instance_t *);
@@ -66,8 +104,19 @@ static wi_runtime_class_t			wb_watcher_runtime_class = {
 };
 
 static wb_watcher_t * 				_wb_watcher_load_with_node(wb_watcher_t *, xmlNodePtr);
+static wb_filetable_t *				_wb_watcher_table_for_directory(wb_watcher_t *, wi_string_t *);
+static void							_wb_watcher_announce_pending_files(wb_watcher_t *, wi_string_t *, wb_filetable_t *);
+static void							_wb_watcher_forget_directory(wb_watcher_t *, wi_string_t *);
+static wi_boolean_t					_wb_watcher_directory_is_watched(wi_string_t *);
+static void							_wb_watcher_announce(wb_watcher_t *, wi_time_interval_t);
+static void							_wb_watcher_announce_file(wb_watcher_t *, wi_string_t *);
+static void							_wb_watcher_service_callback(wb_service_t *, wi_string_t *, wi_string_t *, wi_runtime_instance_t *);
+static void							_wb_watcher_send_outputs(wb_watcher_t *, wi_array_t *, wi_string_t *, wi_string_t *);
+static void							_wb_watcher_send_output(wb_watcher_t *, wb_output_t *, wi_string_t *, wi_string_t *);
+static wi_string_t *				_wb_watcher_compute_summary(wb_watcher_t *, wb_output_t *, wi_array_t *);
+
+static wi_mutable_array_t			*wb_watchers_announcing;
 
-void 								wb_watcher_execute_output(wb_watcher_t *, wb_output_t *, wi_string_t *);
 wi_string_t * 						wb_watcher_compute_output(wb_watcher_t *, wb_output_t *, wi_string_t *);
 
 
@@ -78,6 +127,70 @@ wi_string_t * 						wb_watcher_compute_output(wb_watcher_t *, wb_output_t *, wi_
 
 void wb_watchers_init(void) {
 	wb_watcher_runtime_id = wi_runtime_register_class(&wb_watcher_runtime_class);
+
+	wb_watchers_announcing = wi_array_init(wi_mutable_array_alloc());
+}
+
+
+
+void wb_watchers_reset(void) {
+	// the watchers of a reloaded configuration start over, the old ones
+	// must not be announced from here
+	wi_mutable_array_remove_all_data(wb_watchers_announcing);
+}
+
+
+
+wi_time_interval_t wb_watchers_timeout(void) {
+	wi_enumerator_t			*enumerator;
+	wb_watcher_t			*watcher;
+	wi_time_interval_t		interval, timeout;
+
+	// announcements wait for the first server, the reconnect wakes us
+	if(!wr_connections_first() || !wr_connections_first()->connected)
+		return 30.0;
+
+	interval	= wi_time_interval();
+	timeout		= 30.0;
+	enumerator	= wi_array_data_enumerator(wb_watchers_announcing);
+
+	while((watcher = wi_enumerator_next_data(enumerator))) {
+		if(watcher->announce_time - interval < timeout)
+			timeout = watcher->announce_time - interval;
+	}
+
+	if(timeout < 0.1)
+		timeout = 0.1;
+
+	return timeout;
+}
+
+
+
+void wb_watchers_run(void) {
+	wb_watcher_t			*watcher;
+	wi_time_interval_t		interval;
+	wi_uinteger_t			i;
+
+	if(wi_array_count(wb_watchers_announcing) == 0)
+		return;
+
+	if(!wr_connections_first() || !wr_connections_first()->connected)
+		return;
+
+	interval = wi_time_interval();
+
+	for(i = wi_array_count(wb_watchers_announcing); i > 0; i--) {
+		watcher = WI_ARRAY(wb_watchers_announcing, i - 1);
+
+		if(watcher->announce_time > interval)
+			continue;
+
+		_wb_watcher_announce(watcher, interval);
+
+		if(wi_array_count(watcher->announcements) == 0)
+			wi_mutable_array_remove_data_at_index(wb_watchers_announcing, i - 1);
+	}
 }
 
 
@@ -93,9 +206,15 @@ wb_watcher_t * wb_watcher_init(wb_watcher_t *watcher, xmlNodePtr node) {
 	watcher->type 			= NULL;
 	watcher->services 		= wi_array_init(wi_mutable_array_alloc());
 	watcher->outputs		= wi_array_init(wi_mutable_array_alloc());
+	watcher->summaries		= wi_array_init(wi_mutable_array_alloc());
+	watcher->modified_outputs	= wi_array_init(wi_mutable_array_alloc());
+	watcher->removed_outputs	= wi_array_init(wi_mutable_array_alloc());
+	watcher->announcements	= wi_array_init(wi_mutable_array_alloc());
+	watcher->names			= 5;
 
-	watcher->files 			= wi_array_init(wi_mutable_array_alloc());
-	watcher->new_files		= wi_array_init(wi_mutable_array_alloc());
+	watcher->files 			= wi_dictionary_init(wi_mutable_dictionary_alloc());
+	watcher->pending_files	= wi_dictionary_init(wi_mutable_dictionary_alloc());
+	watcher->directories		= wi_set_init(wi_mutable_set_alloc());
 
 	return _wb_watcher_load_with_node(watcher, node);
 }
@@ -106,7 +225,7 @@ wb_watcher_t * wb_watcher_init(wb_watcher_t *watcher, xmlNodePtr node) {
 #pragma mark -
 
 static wb_watcher_t * _wb_watcher_load_with_node(wb_watcher_t *watcher, xmlNodePtr node) {
-	wi_string_t 			*path, *type, *activated;
+	wi_string_t 			*path, *type, *activated, *recursive, *window, *names, *rate, *event;
 	wb_output_t 			*output;
 	wb_service_t 			*service;
 	xmlNodePtr				sub_node, next_node;
@@ -125,15 +244,50 @@ static wb_watcher_t * _wb_watcher_load_with_node(wb_watcher_t *watcher, xmlNodeP
 	if(activated)
 		watcher->activated = wi_is_equal(activated, WI_STR("true")) ? true : false;
 
-	// get children: services and outputs 
+	// does it watch the whole tree below its path ?
+	recursive = wi_xml_node_attribute_with_name(node, WI_STR("recursive"));
+	if(recursive)
+		watcher->recursive = wi_is_equal(recursive, WI_STR("true")) ? true : false;
+
+	// how added files are announced
+	window = wi_xml_node_attribute_with_name(node, WI_STR("window"));
+	if(window)
+		watcher->window = wi_string_double(window);
+
+	names = wi_xml_node_attribute_with_name(node, WI_STR("names"));
+	if(names)
+		watcher->names = wi_string_uint32(names);
+
+	rate = wi_xml_node_attribute_with_name(node, WI_STR("rate"));
+	if(rate)
+		watcher->rate = wi_string_uint32(rate);
+
+	// get children: services, outputs and summaries
 	for(sub_node = node->children; sub_node != NULL; sub_node = next_node) {
 		next_node = sub_node->next;
 		
 		if(sub_node->type == XML_ELEMENT_NODE) {
 			if(strcmp((const char *) sub_node->name, "output") == 0) {
+				// outputs announce added files unless they name another event
+				event	= wi_xml_node_attribute_with_name(sub_node, WI_STR("event"));
+				output	= wb_output_init(wb_output_alloc(), sub_node);
+				if(output) {
+					if(!event || wi_is_equal(event, WI_STR("added")))
+						wi_mutable_array_add_data(watcher->outputs, output);
+					else if(wi_is_equal(event, WI_STR("modified")))
+						wi_mutable_array_add_data(watcher->modified_outputs, output);
+					else if(wi_is_equal(event, WI_STR("removed")))
+						wi_mutable_array_add_data(watcher->removed_outputs, output);
+					else
+						wi_log_warn(WI_STR("Watcher %@: unknown output event \"%@\""), watcher->path, event);
+				}
+
+				wi_release(output);
+			}
+			else if(strcmp((const char *) sub_node->name, "summary") == 0) {
 				output = wb_output_init(wb_output_alloc(), sub_node);
 				if(output)
-					wi_mutable_array_add_data(watcher->outputs, output);
+					wi_mutable_array_add_data(watcher->summaries, output);
 
 				wi_release(output);
 			}
@@ -160,6 +314,18 @@ wi_boolean_t wb_watcher_activated(wb_watcher_t *watcher) {
 	return watcher->activated;
 }
 
+wi_boolean_t wb_watcher_is_recursive(wb_watcher_t *watcher) {
+	return watcher->recursive;
+}
+
+wi_boolean_t wb_watcher_is_armed(wb_watcher_t *watcher) {
+	return watcher->armed;
+}
+
+void wb_watcher_set_armed(wb_watcher_t *watcher, wi_boolean_t armed) {
+	watcher->armed = armed;
+}
+
 wi_string_t * wb_watcher_path(wb_watcher_t *watcher) {
 	return watcher->path;
 }
@@ -168,12 +334,16 @@ wi_string_t * wb_watcher_type(wb_watcher_t *watcher) {
 	return watcher->type;
 }
 
-wi_mutable_array_t * wb_watcher_files(wb_watcher_t *watcher) {
+wi_mutable_dictionary_t * wb_watcher_files(wb_watcher_t *watcher) {
 	return watcher->files;
 }
 
-wi_mutable_array_t * wb_watcher_new_files(wb_watcher_t *watcher) {
-	return watcher->new_files;
+wi_set_t * wb_watcher_directories(wb_watcher_t *watcher) {
+	return watcher->directories;
+}
+
+wi_array_t * wb_watcher_pending_files(wb_watcher_t *watcher, wi_string_t *directory) {
+	return wi_dictionary_data_for_key(watcher->pending_files, directory);
 }
 
 wi_mutable_array_t * wb_watcher_outputs(wb_watcher_t *watcher) {
@@ -186,116 +356,254 @@ wi_mutable_array_t * wb_watcher_outputs(wb_watcher_t *watcher) {
 
 #pragma mark -
 
-wi_boolean_t wb_watcher_add_file(wb_watcher_t *watcher, wi_string_t *path) {
-	if(!wi_array_contains_data(watcher->files, path)) {
-		wi_mutable_array_add_data(watcher->files, path);
+void wb_watcher_reset(wb_watcher_t *watcher) {
+	// forget everything before an initial listing, so files removed while
+	// we were away do not linger
+	wi_mutable_dictionary_remove_all_data(watcher->files);
+	wi_mutable_dictionary_remove_all_data(watcher->pending_files);
+	wi_mutable_set_remove_all_data(watcher->directories);
+
+	watcher->armed				= false;
+	watcher->files_count		= 0;
+	watcher->files_bytes		= 0;
+	watcher->pending_count		= 0;
+}
+
+wi_boolean_t wb_watcher_add_file(wb_watcher_t *watcher, wi_string_t *path, wi_string_t *directory, wi_p7_uint64_t size, wi_time_interval_t mtime, wi_p7_enum_t type, wi_boolean_t announce) {
+	wb_filetable_t			*table;
+	wb_file_record_t		*record;
+	wi_mutable_array_t		*pending;
+	wi_uinteger_t			bytes;
+	wi_boolean_t			created, modified;
+	uint32_t				interval;
 
-		return true;
+	table = _wb_watcher_table_for_directory(watcher, directory);
+
+	if(!wb_filetable_is_listing(table)) {
+		wb_filetable_begin_listing(table);
+
+		watcher->relist_time = wi_time_interval();
 	}
-	return false;
-}
 
-wi_boolean_t wb_watcher_add_new_file(wb_watcher_t *watcher, wi_string_t *path) {
-	if(!wi_array_contains_data(watcher->new_files, path)) {
-		wi_mutable_array_add_data(watcher->new_files, path);
+	bytes		= wb_filetable_size(table);
+	record		= wb_filetable_add_record(table, wb_filetable_key(path), &created);
+	interval	= (uint32_t) wi_time_interval();
+
+	watcher->files_bytes = watcher->files_bytes - bytes + wb_filetable_size(table);
+
+	if(created) {
+		wb_filetable_set_name(table, record, wi_string_last_path_component(path));
+		
+		record->size		= size;
+		record->mtime		= (uint32_t) mtime;
+		record->changed		= interval;
+		record->type		= type;
+		record->state		= WB_FILE_KNOWN;
+
+		watcher->files_count++;
+
+		// a partial upload is never announced, the finished file shows up
+		// under its own name
+		if(wi_is_equal(wi_string_path_extension(path), WI_STR("WiredTransfer"))) {
+			record->state = WB_FILE_PARTIAL;
+		}
+		else if(announce) {
+			record->state = WB_FILE_PENDING;
+
+			pending = wi_dictionary_data_for_key(watcher->pending_files, directory);
+
+			if(!pending) {
+				pending = wi_mutable_array();
+
+				wi_mutable_dictionary_set_data_for_key(watcher->pending_files, pending, directory);
+			}
+
+			wi_mutable_array_add_data(pending, path);
+
+			watcher->pending_count++;
+		}
 
 		return true;
 	}
+
+	modified = false;
+
+	// a file still growing keeps its announcement back
+	if(record->size != size) {
+		record->size		= size;
+		record->changed		= interval;
+		modified			= true;
+	}
+
+	if(record->mtime != (uint32_t) mtime) {
+		record->mtime		= (uint32_t) mtime;
+		modified			= true;
+	}
+
+	if(modified && record->state == WB_FILE_KNOWN && record->type == WR_FILE_FILE) {
+		wi_log_info(WI_STR("Watcher File Modified: %@"), path);
+
+		_wb_watcher_send_outputs(watcher, watcher->modified_outputs, path, NULL);
+	}
+
 	return false;
 }
 
-void wb_watcher_files_diff(wb_watcher_t *watcher) {
+wi_boolean_t wb_watcher_add_directory(wb_watcher_t *watcher, wi_string_t *path) {
+	if(!watcher->recursive || wi_set_contains_data(watcher->directories, path))
+		return false;
+
+	wi_mutable_set_add_data(watcher->directories, path);
+
+	return true;
+}
+
+void wb_watcher_files_diff(wb_watcher_t *watcher, wi_string_t *directory) {
 	wi_enumerator_t			*enumerator;
-	wi_string_t 			*path;
-	wb_service_t 			*service;
-	int i;
+	wi_mutable_array_t		*removed_names, *removed_directories;
+	wi_string_t 			*path, *name;
+	wb_filetable_t			*table;
+	wi_uinteger_t			count, removed, bytes;
+	struct rusage			usage;
 
-	enumerator = wi_array_data_enumerator(watcher->files);
+	table = _wb_watcher_table_for_directory(watcher, directory);
 
-	while((path = wi_enumerator_next_data(enumerator))) {
-		if(!wi_array_contains_data(watcher->new_files, path)) {
-			if(!wi_is_equal(wi_string_path_extension(path), WI_STR("WiredTransfer"))) {
-				wi_log_info(WI_STR("Watcher File Removed: %@"), path);
-			}
-		}
+	// an empty directory lists no file at all
+	if(!wb_filetable_is_listing(table)) {
+		wb_filetable_begin_listing(table);
+
+		watcher->relist_time = wi_time_interval();
 	}
 
-	enumerator = wi_array_data_enumerator(watcher->new_files);
+	// records of the files that went away are still held here, which is
+	// the peak of a listing
+	if(watcher->files_count > watcher->peak_entries)
+		watcher->peak_entries = watcher->files_count;
 
-	while((path = wi_enumerator_next_data(enumerator))) {
-		if(!wi_array_contains_data(watcher->files, path)) {
-			if(!wi_is_equal(wi_string_path_extension(path), WI_STR("WiredTransfer"))) {
-				if(wi_array_count(watcher->outputs) > 0) {
-					wi_log_info(WI_STR("Watcher File Added: %@"), path);
-					
-					for(i = 0; i < wi_array_count(watcher->outputs); i++) {
-						wb_watcher_execute_output(watcher, wi_array_data_at_index(watcher->outputs, i), path);
-					}
-				}
-			}
+	if(watcher->files_bytes > watcher->peak_bytes)
+		watcher->peak_bytes = watcher->files_bytes;
+
+	if(getrusage(RUSAGE_SELF, &usage) == 0 && usage.ru_maxrss > watcher->peak_rss)
+		watcher->peak_rss = usage.ru_maxrss;
+
+	watcher->relists++;
+
+	count		= wb_filetable_count(table);
+	bytes		= wb_filetable_size(table);
+	removed_names	= wi_mutable_array();
+	removed			= wb_filetable_end_listing(table, removed_names);
+
+	watcher->files_count	-= count - wb_filetable_count(table);
+	watcher->files_bytes	= watcher->files_bytes - bytes + wb_filetable_size(table);
+
+	wi_log_debug(WI_STR("Watcher %@: listed %u files of %@ in %.3f seconds, %u records in %u bytes held"),
+		watcher->path, wb_filetable_count(table), directory, wi_time_interval() - watcher->relist_time,
+		watcher->files_count, watcher->files_bytes);
+
+	if(removed > 0) {
+		enumerator = wi_array_data_enumerator(removed_names);
+		
+		while((name = wi_enumerator_next_data(enumerator))) {
+			path = wi_string_by_appending_path_component(directory, name);
+
+			wi_log_info(WI_STR("Watcher File Removed: %@"), path);
+
+			_wb_watcher_send_outputs(watcher, watcher->removed_outputs, path, NULL);
 		}
+
+		// a directory gone from the listing takes its whole subtree with it
+		removed_directories		= wi_mutable_array();
+		enumerator				= wi_set_data_enumerator(watcher->directories);
+
+		while((path = wi_enumerator_next_data(enumerator))) {
+			if(wi_is_equal(wi_string_by_deleting_last_path_component(path), directory) &&
+			   !wb_filetable_record(table, wb_filetable_key(path)))
+				wi_mutable_array_add_data(removed_directories, path);
+		}
+
+		enumerator = wi_array_data_enumerator(removed_directories);
+
+		while((path = wi_enumerator_next_data(enumerator)))
+			_wb_watcher_forget_directory(watcher, path);
 	}
 
-	wi_release(watcher->files);
+	_wb_watcher_announce_pending_files(watcher, directory, table);
+
+	// a table is kept for every directory listed, drop the empty ones
+	if(wb_filetable_count(table) == 0) {
+		watcher->files_bytes -= wb_filetable_size(table);
 
-	watcher->files = wi_copy(watcher->new_files);
-	wi_mutable_array_remove_all_data(watcher->new_files);
+		wi_mutable_dictionary_remove_data_for_key(watcher->files, directory);
+	}
 }
 
 
 
-void wb_watcher_execute_output(wb_watcher_t *watcher, wb_output_t *output, wi_string_t *path) {
-	wi_p7_message_t 	*message;
-	wb_service_t 		*service;
-	wi_string_t 		*board, *subject, *text, *output_string;
+void wb_watcher_files_abort(wb_watcher_t *watcher, wi_string_t *directory) {
+	wb_filetable_t			*table;
 
-	service = NULL;
+	table = wi_dictionary_data_for_key(watcher->files, directory);
 
-	if(wi_array_count(watcher->services) > 0) {
-		service = wi_array_data_at_index(watcher->services, 0);
+	if(!table)
+		return;
+
+	// a listing cut short says nothing about the files it did not send
+	wb_filetable_cancel_listing(table);
+
+	if(wb_filetable_count(table) == 0) {
+		watcher->files_bytes -= wb_filetable_size(table);
 
-		wb_service_set_file_path(service, path);
-		wb_service_execute(service, watcher);
+		wi_mutable_dictionary_remove_data_for_key(watcher->files, directory);
 	}
+}
 
-	if(wi_is_equal(wb_output_message_name(output), WI_STR("wired.board.add_thread"))) {
-		board = wb_output_board(output);
 
-		if(board) {
-			output_string = wb_watcher_compute_output(watcher, output, path);
-
-			if(service && wb_service_text(service)) {
-				text = wb_service_text(service);
-			} else {
-				text = wi_string_with_format(
-					WI_STR("[b]Name:[/b] %@\n[b]Path:[/b] %@\n"), 
-					wi_string_last_path_component(path), 
-					watcher->path);
-			}
 
-			message = wi_p7_message_with_name(WI_STR("wired.board.add_thread"), wr_p7_spec);
-			wi_p7_message_set_string_for_name(message, board, WI_STR("wired.board.board"));
-			wi_p7_message_set_string_for_name(message, output_string, WI_STR("wired.board.subject"));
-			wi_p7_message_set_string_for_name(message, text, WI_STR("wired.board.text"));
+void wb_watcher_announce_file(wb_watcher_t *watcher, wi_string_t *path, wi_file_offset_t size) {
+	if(wi_is_equal(wi_string_path_extension(path), WI_STR("WiredTransfer")))
+		return;
 
-			if(message) {
-				if(wr_connected) {
-					wr_client_send_message(message);
-				}
-			}
-		}	
-	} 
-	else if(wi_is_equal(wb_output_message_name(output), WI_STR("wired.chat.say"))) {
-		output_string = wb_watcher_compute_output(watcher, output, path);
-		wr_commands_parse_command(output_string, true);
-	} 
+	if(wi_array_count(watcher->outputs) == 0 && wi_array_count(watcher->summaries) == 0)
+		return;
+
+	if(watcher->window <= 0.0 && watcher->rate == 0 && wi_array_count(watcher->summaries) == 0) {
+		_wb_watcher_announce_file(watcher, path);
+
+		return;
+	}
+
+	// the window opens with the first file, files added meanwhile do not
+	// push it back
+	if(wi_array_count(watcher->announcements) == 0) {
+		if(watcher->announce_time < wi_time_interval() + watcher->window)
+			watcher->announce_time = wi_time_interval() + watcher->window;
 
-	if(service) {
-		wb_service_cleanup(service);
+		if(!wi_array_contains_data(wb_watchers_announcing, watcher))
+			wi_mutable_array_add_data(wb_watchers_announcing, watcher);
 	}
+
+	wi_mutable_array_add_data(watcher->announcements, path);
+
+	watcher->announcements_size += size;
 }
 
 
+
+void wb_watcher_log_statistics(wb_watcher_t *watcher) {
+	// ru_maxrss is the process high-water mark, in kilobytes on Linux and bytes on Darwin
+	wi_log_info(WI_STR("Watcher %@: %u files in %u record bytes, %u held back, %u listings, peak %u records and %u bytes, process peak RSS %ld"),
+		watcher->path,
+		watcher->files_count,
+		watcher->files_bytes,
+		watcher->pending_count,
+		watcher->relists,
+		watcher->peak_entries,
+		watcher->peak_bytes,
+		watcher->peak_rss);
+}
+
+
+
 wi_string_t * wb_watcher_compute_output(wb_watcher_t *watcher, wb_output_t *output, wi_string_t *path) {
 	wi_string_t 		*result;
 
@@ -318,6 +626,322 @@ wi_string_t * wb_watcher_compute_output(wb_watcher_t *watcher, wb_output_t *outp
 
 #pragma mark -
 
+static void _wb_watcher_announce(wb_watcher_t *watcher, wi_time_interval_t interval) {
+	wi_array_t			*paths;
+	wi_string_t			*path, *text;
+	wb_output_t			*output;
+	wi_uinteger_t		i, count;
+
+	count = wi_array_count(watcher->announcements);
+
+	// one summary for the whole window, services are not run for it
+	if(wi_array_count(watcher->summaries) > 0 && count > 1) {
+		paths = wi_autorelease(wi_copy(watcher->announcements));
+
+		text	= wi_string_with_format(WI_STR("[b]Files:[/b] %u\n[b]Size:[/b] %@\n[b]Path:[/b] %@\n"),
+			count, wr_files_string_for_size(watcher->announcements_size), watcher->path);
+
+		wi_log_info(WI_STR("Watcher Files Added: %u files in %@"), count, watcher->path);
+
+		for(i = 0; i < wi_array_count(watcher->summaries); i++) {
+			output = WI_ARRAY(watcher->summaries, i);
+
+			_wb_watcher_send_output(watcher, output, _wb_watcher_compute_summary(watcher, output, paths), text);
+		}
+
+		wi_mutable_array_remove_all_data(watcher->announcements);
+		watcher->announcements_size = 0;
+
+		return;
+	}
+
+	// one file by one, a single one per run when a rate is set
+	do {
+		path = wi_autorelease(wi_retain(WI_ARRAY(watcher->announcements, 0)));
+
+		wi_mutable_array_remove_data_at_index(watcher->announcements, 0);
+
+		_wb_watcher_announce_file(watcher, path);
+	} while(watcher->rate == 0 && wi_array_count(watcher->announcements) > 0);
+
+	if(watcher->rate > 0)
+		watcher->announce_time = interval + 60.0 / watcher->rate;
+
+	if(wi_array_count(watcher->announcements) == 0)
+		watcher->announcements_size = 0;
+}
+
+
+
+static void _wb_watcher_announce_file(wb_watcher_t *watcher, wi_string_t *path) {
+	wi_log_info(WI_STR("Watcher File Added: %@"), path);
+
+	// the outputs go out when the service answers, the bot carries on
+	// meanwhile
+	if(wi_array_count(watcher->services) > 0) {
+		if(wb_service_lookup(WI_ARRAY(watcher->services, 0), path, _wb_watcher_service_callback, watcher))
+			return;
+	}
+
+	_wb_watcher_send_outputs(watcher, watcher->outputs, path, NULL);
+}
+
+
+
+static void _wb_watcher_service_callback(wb_service_t *service, wi_string_t *path, wi_string_t *text, wi_runtime_instance_t *context) {
+	wb_watcher_t		*watcher = context;
+
+	_wb_watcher_send_outputs(watcher, watcher->outputs, path, text);
+}
+
+
+
+static void _wb_watcher_send_outputs(wb_watcher_t *watcher, wi_array_t *outputs, wi_string_t *path, wi_string_t *text) {
+	wb_output_t			*output;
+	wi_uinteger_t		i;
+
+	if(wi_array_count(outputs) == 0)
+		return;
+
+	if(!text) {
+		text = wi_string_with_format(
+			WI_STR("[b]Name:[/b] %@\n[b]Path:[/b] %@\n"), 
+			wi_string_last_path_component(path), 
+			watcher->path);
+	}
+
+	for(i = 0; i < wi_array_count(outputs); i++) {
+		output = WI_ARRAY(outputs, i);
+
+		_wb_watcher_send_output(watcher, output, wb_watcher_compute_output(watcher, output, path), text);
+	}
+}
+
+
+
+static void _wb_watcher_send_output(wb_watcher_t *watcher, wb_output_t *output, wi_string_t *string, wi_string_t *text) {
+	wi_p7_message_t 	*message;
+	wi_string_t 		*board;
+	wr_connection_t		*connection;
+
+	// watchers are served by the first configured server, whichever
+	// connection the runloop happens to be handling
+	connection = wr_connections_first();
+
+	if(!connection || !connection->connected)
+		return;
+
+	if(wb_output_message_id(output) == WR_MESSAGE_BOARD_ADD_THREAD) {
+		board = wb_output_board(output);
+
+		if(board) {
+			message = wi_p7_message_with_name(WI_STR("wired.board.add_thread"), wr_p7_spec);
+			wi_p7_message_set_string_for_name(message, board, WI_STR("wired.board.board"));
+			wi_p7_message_set_string_for_name(message, string, WI_STR("wired.board.subject"));
+			wi_p7_message_set_string_for_name(message, text, WI_STR("wired.board.text"));
+
+			if(message)
+				wr_client_send_message_on_connection(connection, message);
+		}	
+	} 
+	else if(wb_output_message_id(output) == WR_MESSAGE_CHAT_SAY) {
+		message = wi_p7_message_with_name(WI_STR("wired.chat.send_say"), wr_p7_spec);
+		wi_p7_message_set_uint32_for_name(message, wr_chat_id(connection->public_chat), WI_STR("wired.chat.id"));
+		wi_p7_message_set_string_for_name(message, string, WI_STR("wired.chat.say"));
+
+		wr_client_send_message_on_connection(connection, message);
+	} 
+}
+
+
+
+static wi_string_t * _wb_watcher_compute_summary(wb_watcher_t *watcher, wb_output_t *output, wi_array_t *paths) {
+	wi_mutable_string_t		*names;
+	wi_string_t				*result;
+	wi_uinteger_t			i, count;
+
+	count	= wi_array_count(paths);
+	names	= wi_mutable_string();
+
+	for(i = 0; i < count && i < watcher->names; i++) {
+		if(i > 0)
+			wi_mutable_string_append_string(names, WI_STR(", "));
+
+		wi_mutable_string_append_string(names, wi_string_last_path_component(WI_ARRAY(paths, i)));
+	}
+
+	if(count > watcher->names)
+		wi_mutable_string_append_format(names, WI_STR(" and %u more"), count - watcher->names);
+
+	result = wb_output_output(output);
+	result = wi_string_by_replacing_string_with_string(result, WB_WATCHER_PATH, watcher->path, 0);
+	result = wi_string_by_replacing_string_with_string(result, WB_WATCHER_COUNT, wi_string_with_format(WI_STR("%u"), count), 0);
+	result = wi_string_by_replacing_string_with_string(result, WB_WATCHER_FILES, names, 0);
+	result = wi_string_by_replacing_string_with_string(result, WB_WATCHER_SIZE, wr_files_string_for_size(watcher->announcements_size), 0);
+
+	return result;
+}
+
+
+
+static wb_filetable_t * _wb_watcher_table_for_directory(wb_watcher_t *watcher, wi_string_t *directory) {
+	wb_filetable_t			*table;
+
+	table = wi_dictionary_data_for_key(watcher->files, directory);
+
+	if(!table) {
+		table = wb_filetable_init(wb_filetable_alloc());
+
+		wi_mutable_dictionary_set_data_for_key(watcher->files, table, directory);
+		wi_release(table);
+
+		watcher->files_bytes += wb_filetable_size(table);
+	}
+
+	return table;
+}
+
+
+
+static void _wb_watcher_announce_pending_files(wb_watcher_t *watcher, wi_string_t *directory, wb_filetable_t *table) {
+	wi_enumerator_t			*enumerator;
+	wi_mutable_array_t		*held;
+	wi_array_t				*pending;
+	wi_string_t 			*path;
+	wb_file_record_t		*record;
+	wi_uinteger_t			stable, elapsed, delay;
+	uint32_t				interval;
+
+	pending = wi_dictionary_data_for_key(watcher->pending_files, directory);
+
+	if(!pending)
+		return;
+
+	// announce the new files whose size held for the stable time, in
+	// listing order so outputs fire in a stable order, and look again
+	// for the others when the first of them is due
+	stable		= wi_config_integer_for_name(wd_config, WI_STR("watcher stable time"));
+	interval	= (uint32_t) wi_time_interval();
+	held		= NULL;
+	delay		= stable;
+	enumerator	= wi_array_data_enumerator(pending);
+
+	while((path = wi_enumerator_next_data(enumerator))) {
+		record = wb_filetable_record(table, wb_filetable_key(path));
+
+		// gone before it settled
+		if(!record || record->state != WB_FILE_PENDING)
+			continue;
+
+		elapsed = interval - record->changed;
+
+		if(elapsed < stable) {
+			if(!held)
+				held = wi_mutable_array();
+
+			wi_mutable_array_add_data(held, path);
+
+			if(stable - elapsed < delay)
+				delay = stable - elapsed;
+
+			continue;
+		}
+
+		record->state = WB_FILE_KNOWN;
+
+		wb_watcher_announce_file(watcher, path, record->size);
+	}
+
+	watcher->pending_count = watcher->pending_count - wi_array_count(pending) + (held ? wi_array_count(held) : 0);
+
+	if(held) {
+		wi_mutable_dictionary_set_data_for_key(watcher->pending_files, held, directory);
+		wb_listings_recheck(directory, delay);
+	} else {
+		wi_mutable_dictionary_remove_data_for_key(watcher->pending_files, directory);
+	}
+}
+
+
+
+static void _wb_watcher_forget_directory(wb_watcher_t *watcher, wi_string_t *directory) {
+	wi_enumerator_t			*enumerator;
+	wi_mutable_array_t		*directories;
+	wi_array_t				*pending;
+	wi_p7_message_t			*message;
+	wr_connection_t			*connection;
+	wb_filetable_t			*table;
+	wi_string_t				*path, *prefix;
+
+	directories	= wi_mutable_array();
+	prefix		= wi_string_by_appending_string(directory, WI_STR("/"));
+	enumerator	= wi_set_data_enumerator(watcher->directories);
+
+	while((path = wi_enumerator_next_data(enumerator))) {
+		if(wi_is_equal(path, directory) || wi_string_has_prefix(path, prefix))
+			wi_mutable_array_add_data(directories, path);
+	}
+
+	connection	= wr_connections_first();
+	enumerator	= wi_array_data_enumerator(directories);
+
+	while((path = wi_enumerator_next_data(enumerator))) {
+		wi_mutable_set_remove_data(watcher->directories, path);
+
+		// the subscription goes too, unless another watcher still needs it
+		if(connection && connection->connected && !_wb_watcher_directory_is_watched(path)) {
+			message = wi_p7_message_with_name(WI_STR("wired.file.unsubscribe_directory"), wr_p7_spec);
+			wi_p7_message_set_string_for_name(message, path, WI_STR("wired.file.path"));
+
+			wr_client_send_message_on_connection(connection, message);
+		}
+
+		table = wi_dictionary_data_for_key(watcher->files, path);
+
+		if(table) {
+			watcher->files_count -= wb_filetable_count(table);
+			watcher->files_bytes -= wb_filetable_size(table);
+
+			wi_mutable_dictionary_remove_data_for_key(watcher->files, path);
+		}
+
+		pending = wi_dictionary_data_for_key(watcher->pending_files, path);
+
+		if(pending) {
+			watcher->pending_count -= wi_array_count(pending);
+
+			wi_mutable_dictionary_remove_data_for_key(watcher->pending_files, path);
+		}
+	}
+
+	wi_log_debug(WI_STR("Watcher %@: forgot %u directories below %@"),
+		watcher->path, wi_array_count(directories), directory);
+}
+
+
+
+static wi_boolean_t _wb_watcher_directory_is_watched(wi_string_t *path) {
+	wi_enumerator_t			*enumerator;
+	wi_array_t				*watchers;
+	wb_watcher_t			*watcher;
+
+	watchers = wb_bot ? wb_bot_watchers_for_path(wb_bot, path) : NULL;
+
+	if(!watchers)
+		return false;
+
+	enumerator = wi_array_data_enumerator(watchers);
+
+	while((watcher = wi_enumerator_next_data(enumerator))) {
+		if(wi_is_equal(watcher->path, path) || wi_set_contains_data(watcher->directories, path))
+			return true;
+	}
+
+	return false;
+}
+
+
+
 static void wb_watcher_dealloc(wi_runtime_instance_t *instance) {
 	wb_watcher_t		* watcher = instance;
 
@@ -325,8 +949,13 @@ static void wb_watcher_dealloc(wi_runtime_instance_t *instance) {
 	wi_release(watcher->type);
 	wi_release(watcher->services);
 	wi_release(watcher->outputs);
+	wi_release(watcher->summaries);
+	wi_release(watcher->modified_outputs);
+	wi_release(watcher->removed_outputs);
+	wi_release(watcher->announcements);
 	wi_release(watcher->files);
-	wi_release(watcher->new_files);
+	wi_release(watcher->pending_files);
+	wi_release(watcher->directories);
 }
 
 static wi_string_t * wb_watcher_description(wi_runtime_instance_t *instance) {
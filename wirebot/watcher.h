@@ -10,24 +10,38 @@
 #define WB_WATCHER_PATH				WI_STR("@WATCHER_PATH")
 #define WB_WATCHER_FILE				WI_STR("@WATCHER_FILE")
 #define WB_WATCHER_TEXT 			WI_STR("@WATCHER_TEXT")
+#define WB_WATCHER_COUNT			WI_STR("@WATCHER_COUNT")
+#define WB_WATCHER_FILES			WI_STR("@WATCHER_FILES")
+#define WB_WATCHER_SIZE				WI_STR("@WATCHER_SIZE")
 
 typedef struct _wb_watcher			wb_watcher_t;
 
 void 								wb_watchers_init(void);
+void								wb_watchers_reset(void);
+wi_time_interval_t					wb_watchers_timeout(void);
+void								wb_watchers_run(void);
 
 wb_watcher_t * 						wb_watcher_alloc(void);
 wb_watcher_t * 						wb_watcher_init(wb_watcher_t *, xmlNodePtr);
 
 wi_boolean_t						wb_watcher_activated(wb_watcher_t *);
+wi_boolean_t						wb_watcher_is_recursive(wb_watcher_t *);
+wi_boolean_t						wb_watcher_is_armed(wb_watcher_t *);
+void								wb_watcher_set_armed(wb_watcher_t *, wi_boolean_t);
 wi_string_t *						wb_watcher_path(wb_watcher_t *);
 wi_string_t *				 		wb_watcher_type(wb_watcher_t *);
-wi_mutable_array_t *				wb_watcher_files(wb_watcher_t *);
-wi_mutable_array_t * 				wb_watcher_new_files(wb_watcher_t *);
+wi_mutable_dictionary_t *			wb_watcher_files(wb_watcher_t *);
+wi_set_t *							wb_watcher_directories(wb_watcher_t *);
+wi_array_t *						wb_watcher_pending_files(wb_watcher_t *, wi_string_t *);
 wi_mutable_array_t * 				wb_watcher_outputs(wb_watcher_t *);
 
-wi_boolean_t						wb_watcher_add_file(wb_watcher_t *, wi_string_t *);
-wi_boolean_t						wb_watcher_add_new_file(wb_watcher_t *, wi_string_t *);
+void								wb_watcher_reset(wb_watcher_t *);
+wi_boolean_t						wb_watcher_add_file(wb_watcher_t *, wi_string_t *, wi_string_t *, wi_p7_uint64_t, wi_time_interval_t, wi_p7_enum_t, wi_boolean_t);
+wi_boolean_t						wb_watcher_add_directory(wb_watcher_t *, wi_string_t *);
 
-void								wb_watcher_files_diff(wb_watcher_t *);
+void								wb_watcher_files_diff(wb_watcher_t *, wi_string_t *);
+void								wb_watcher_files_abort(wb_watcher_t *, wi_string_t *);
+void								wb_watcher_announce_file(wb_watcher_t *, wi_string_t *, wi_file_offset_t);
+void								wb_watcher_log_statistics(wb_watcher_t *);
 
 #endif /* WR_WATCHER_H */
\ No newline at end of file
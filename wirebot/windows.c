@@ -79,7 +79,7 @@ void wr_windows_initialize(void) {
 
 	wr_windows = wi_array_init(wi_mutable_array_alloc());
 
-	wr_console_window = wr_window_init_with_chat(wr_window_alloc(), wr_public_chat);
+	wr_console_window = wr_window_init_with_chat(wr_window_alloc(), wr_connection->public_chat);
 	wr_windows_add_window(wr_console_window);
 
 	wr_windows_show_window(wr_console_window);
@@ -327,13 +327,13 @@ wi_boolean_t wr_window_is_chat(wr_window_t *window) {
 
 
 wi_boolean_t wr_window_is_public_chat(wr_window_t *window) {
-	return (window->type == WR_WINDOW_TYPE_CHAT && wi_is_equal(window->chat, wr_public_chat));
+	return (window->type == WR_WINDOW_TYPE_CHAT && wi_is_equal(window->chat, wr_connection->public_chat));
 }
 
 
 
 wi_boolean_t wr_window_is_private_chat(wr_window_t *window) {
-	return (window->type == WR_WINDOW_TYPE_CHAT && !wi_is_equal(window->chat, wr_public_chat));
+	return (window->type == WR_WINDOW_TYPE_CHAT && !wi_is_equal(window->chat, wr_connection->public_chat));
 }
 
 
@@ -618,7 +618,7 @@ void wr_print_users(wr_window_t *window) {
 	wr_user_t       *user;
 	wi_uinteger_t    max_length = 0;
 	
-	if(window->chat == wr_public_chat)
+	if(window->chat == wr_connection->public_chat)
 		wr_printf_prefix(WI_STR("Users currently online:"));
 	else
 		wr_printf_prefix(WI_STR("Users in chat:"));
@@ -775,11 +775,11 @@ void wr_draw_divider(void) {
 	
 	string = wi_mutable_string_with_format(WI_STR("%s%@"), WR_PREFIX, wr_nick);
 	
-	if(wr_connected && wr_server) {
+	if(wr_connection->connected && wr_connection->server) {
 		users = wi_array_count(wr_chat_users(wr_console_window->chat));
 		
 		wi_mutable_string_append_format(string, WI_STR(" - %@ - %u %@"),
-										wr_server_name(wr_server),
+										wr_server_name(wr_connection->server),
 										users,
 										users == 1
 											? WI_STR("user")